@@ -740,6 +740,8 @@ gdk_pixbuf_loader_close (GdkPixbufLoader *loader,
 
         if (priv->needs_scale) 
                 {
+                        if (priv->animation)
+                                _gdk_pixbuf_scaled_anim_set_loaded ((GdkPixbufScaledAnim *) priv->animation);
 
                         g_signal_emit (loader, pixbuf_loader_signals[AREA_PREPARED], 0);
                         g_signal_emit (loader, pixbuf_loader_signals[AREA_UPDATED], 0, 
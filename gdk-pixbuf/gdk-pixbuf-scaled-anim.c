@@ -22,6 +22,7 @@
  *
  */
 
+#include <stdlib.h>
 #include <glib.h>
 
 #include "gdk-pixbuf.h"
@@ -35,6 +36,17 @@ struct _GdkPixbufScaledAnimClass
         GdkPixbufAnimationClass parent_class;
 };
 
+/* Scaled frames are kept in a cache shared by all iterators, so that
+ * looping animations are only scaled once. Once the loader is done, the
+ * cache is filled frame by frame as the frames are first shown, and is
+ * keyed by the frame pixbufs the wrapped animation hands out.
+ */
+typedef enum {
+        FRAMES_UNKNOWN,         /* not tried yet */
+        FRAMES_CACHED,
+        FRAMES_UNCACHED         /* over budget or disabled */
+} FramesState;
+
 struct _GdkPixbufScaledAnim
 {
  	GdkPixbufAnimation parent_instance;
@@ -45,6 +57,12 @@ struct _GdkPixbufScaledAnim
 	gdouble tscale;
 
 	GdkPixbuf *current;
+
+        gboolean loaded;
+        FramesState frames_state;
+        GHashTable *frames;     /* frame pixbuf -> scaled pixbuf */
+        gsize frames_size;
+        gsize frames_budget;
 };
 
 struct _GdkPixbufScaledAnimIterClass
@@ -63,6 +81,26 @@ struct _GdkPixbufScaledAnimIter
 typedef struct _GdkPixbufScaledAnimIter GdkPixbufScaledAnimIter;
 typedef struct _GdkPixbufScaledAnimIterClass GdkPixbufScaledAnimIterClass;
 
+/* Upper bound for the memory used by the scaled frames of one animation.
+ * Animations that need more are scaled frame by frame, as they are shown.
+ * The budget can be changed, in kilobytes, with the
+ * GDK_PIXBUF_ANIM_FRAME_CACHE environment variable; 0 turns the cache off.
+ */
+#define DEFAULT_FRAME_CACHE_BUDGET (4 * 1024 * 1024)
+/* Don't keep caching animations that never repeat a frame */
+#define MAX_CACHED_FRAMES 1024
+
+static gsize
+get_frame_cache_budget (void)
+{
+        const gchar *env = g_getenv ("GDK_PIXBUF_ANIM_FRAME_CACHE");
+
+        if (env)
+                return (gsize) MAX (atoi (env), 0) * 1024;
+
+        return DEFAULT_FRAME_CACHE_BUDGET;
+}
+
 GdkPixbufScaledAnim *
 _gdk_pixbuf_scaled_anim_new (GdkPixbufAnimation *anim,
                              gdouble             xscale,
@@ -77,10 +115,20 @@ _gdk_pixbuf_scaled_anim_new (GdkPixbufAnimation *anim,
 	scaled->xscale = xscale;
 	scaled->yscale = yscale;
 	scaled->tscale = tscale;
+        scaled->frames_budget = get_frame_cache_budget ();
 
 	return scaled;
 }
 
+/* Called by the loader once the wrapped animation is complete; until
+ * then frames are scaled as they are shown.
+ */
+void
+_gdk_pixbuf_scaled_anim_set_loaded (GdkPixbufScaledAnim *scaled)
+{
+        scaled->loaded = TRUE;
+}
+
 G_DEFINE_TYPE (GdkPixbufScaledAnim, gdk_pixbuf_scaled_anim, GDK_TYPE_PIXBUF_ANIMATION);
 
 static void
@@ -106,6 +154,11 @@ gdk_pixbuf_scaled_anim_finalize (GObject *object)
 		scaled->current = NULL;
 	}
 
+        if (scaled->frames) {
+                g_hash_table_destroy (scaled->frames);
+                scaled->frames = NULL;
+        }
+
 	G_OBJECT_CLASS (gdk_pixbuf_scaled_anim_parent_class)->finalize (object);
 }
 
@@ -118,14 +171,12 @@ is_static_image (GdkPixbufAnimation *anim)
 }	
 
 static GdkPixbuf *
-get_scaled_pixbuf (GdkPixbufScaledAnim *scaled, 
-                   GdkPixbuf           *pixbuf)
+scale_pixbuf (GdkPixbufScaledAnim *scaled, 
+              GdkPixbuf           *pixbuf)
 {
 	GQuark  quark;
 	gchar **options;
-
-	if (scaled->current) 
-		g_object_unref (scaled->current);
+        GdkPixbuf *result;
 
 	/* Preserve the options associated with the original pixbuf 
 	   (if present), mostly so that client programs can use the
@@ -138,16 +189,90 @@ get_scaled_pixbuf (GdkPixbufScaledAnim *scaled,
 	options = g_object_get_qdata (G_OBJECT (pixbuf), quark);
 
 	/* Get a new scaled pixbuf */
-	scaled->current  = gdk_pixbuf_scale_simple (pixbuf, 
+	result = gdk_pixbuf_scale_simple (pixbuf, 
 			(int) (gdk_pixbuf_get_width (pixbuf) * scaled->xscale + .5),
 			(int) (gdk_pixbuf_get_height (pixbuf) * scaled->yscale + .5),
 			GDK_INTERP_BILINEAR);
 
 	/* Copy the original pixbuf options to the scaled pixbuf */
-        if (options && scaled->current)
-	          g_object_set_qdata_full (G_OBJECT (scaled->current), quark, 
+        if (options && result)
+	          g_object_set_qdata_full (G_OBJECT (result), quark, 
                                            g_strdupv (options), (GDestroyNotify) g_strfreev);
 
+	return result;
+}
+
+static void
+ensure_frames (GdkPixbufScaledAnim *scaled)
+{
+        /* Frames may still change while the animation is loading */
+        if (scaled->frames_state != FRAMES_UNKNOWN || !scaled->loaded)
+                return;
+
+        /* A single image is scaled once anyway */
+        if (scaled->frames_budget == 0 ||
+            gdk_pixbuf_animation_is_static_image (scaled->anim)) {
+                scaled->frames_state = FRAMES_UNCACHED;
+                return;
+        }
+
+        scaled->frames = g_hash_table_new_full (g_direct_hash, g_direct_equal,
+                                                g_object_unref, g_object_unref);
+        scaled->frames_state = FRAMES_CACHED;
+}
+
+/* Adds a newly scaled frame to the cache. Once the frames shown so far
+ * add up to more than the budget, the cache is dropped and the rest of
+ * the animation is scaled frame by frame.
+ */
+static gboolean
+cache_frame (GdkPixbufScaledAnim *scaled,
+             GdkPixbuf           *pixbuf,
+             GdkPixbuf           *result)
+{
+        gsize size;
+
+        size = (gsize) gdk_pixbuf_get_height (result) * gdk_pixbuf_get_rowstride (result);
+
+        if (g_hash_table_size (scaled->frames) >= MAX_CACHED_FRAMES ||
+            size > scaled->frames_budget - scaled->frames_size) {
+                g_hash_table_destroy (scaled->frames);
+                scaled->frames = NULL;
+                scaled->frames_size = 0;
+                scaled->frames_state = FRAMES_UNCACHED;
+                return FALSE;
+        }
+
+        g_hash_table_insert (scaled->frames, g_object_ref (pixbuf), result);
+        scaled->frames_size += size;
+
+        return TRUE;
+}
+
+static GdkPixbuf *
+get_scaled_pixbuf (GdkPixbufScaledAnim *scaled, 
+                   GdkPixbuf           *pixbuf)
+{
+        GdkPixbuf *result;
+
+        ensure_frames (scaled);
+
+        if (scaled->frames) {
+                result = g_hash_table_lookup (scaled->frames, pixbuf);
+                if (result)
+                        return result;
+        }
+
+        result = scale_pixbuf (scaled, pixbuf);
+
+        if (scaled->frames && result && cache_frame (scaled, pixbuf, result))
+                return result;
+
+	if (scaled->current) 
+		g_object_unref (scaled->current);
+
+        scaled->current = result;
+
 	return scaled->current;
 }
 
@@ -234,6 +359,7 @@ get_pixbuf (GdkPixbufAnimationIter *iter)
 	GdkPixbuf *pixbuf;
 
 	pixbuf = gdk_pixbuf_animation_iter_get_pixbuf (scaled->iter);
+
 	return get_scaled_pixbuf (scaled->scaled, pixbuf);
 }
 
@@ -41,6 +41,7 @@ GdkPixbufScaledAnim *_gdk_pixbuf_scaled_anim_new (GdkPixbufAnimation *anim,
                                                   gdouble             xscale, 
                                                   gdouble             yscale,
                                                   gdouble             tscale);
+void                 _gdk_pixbuf_scaled_anim_set_loaded (GdkPixbufScaledAnim *scaled);
 
 G_END_DECLS
 
@@ -21,6 +21,7 @@
  */
 #include "config.h"
 #include <math.h>
+#include <stdlib.h>
 #include <glib.h>
 
 #include "pixops.h"
@@ -67,6 +68,25 @@ struct _PixopsFilter
   double overall_alpha;
 }; 
 
+typedef struct _PixopsFilterEntry PixopsFilterEntry;
+
+/* A filter together with its table of combined integer weights, as
+ * kept in the filter cache; see pixops_filter_get().
+ */
+struct _PixopsFilterEntry
+{
+  PixopsInterpType interp_type;
+  double scale_x;
+  double scale_y;
+  int overall_alpha;
+
+  PixopsFilter filter;
+  int *weights;
+  gsize size;
+
+  int ref_count;
+};
+
 typedef guchar *(*PixopsLineFunc) (int *weights, int n_x, int n_y,
 				   guchar *dest, int dest_x, guchar *dest_end,
 				   int dest_channels, int dest_has_alpha,
@@ -1222,149 +1242,366 @@ make_filter_table (PixopsFilter *filter)
   return weights;
 }
 
+/* State shared, read-only, by all the row bands of one pixops_process()
+ * call.
+ */
+typedef struct _PixopsProcess PixopsProcess;
+
+struct _PixopsProcess
+{
+  guchar         *dest_buf;
+  int             render_x0;
+  int             render_x1;
+  int             dest_rowstride;
+  int             dest_channels;
+  gboolean        dest_has_alpha;
+  const guchar   *src_buf;
+  int             src_width;
+  int             src_height;
+  int             src_rowstride;
+  int             src_channels;
+  gboolean        src_has_alpha;
+  int             check_x;
+  int             check_y;
+  int             check_size;
+  guint32         color1;
+  guint32         color2;
+  PixopsFilter   *filter;
+  PixopsLineFunc  line_func;
+  PixopsPixelFunc pixel_func;
+
+  int            *filter_weights;
+  int             x_step;
+  int             y_step;
+  int             y_start;
+  int             check_shift;
+  int             scaled_x_offset;
+  int             run_end_index;
+};
+
+/* Renders destination rows first_row to last_row - 1. Every row only
+ * depends on its index, so the rows can be rendered in any order, and
+ * from any thread, with identical results.
+ */
 static void
-pixops_process (guchar         *dest_buf,
-		int             render_x0,
-		int             render_y0,
-		int             render_x1,
-		int             render_y1,
-		int             dest_rowstride,
-		int             dest_channels,
-		gboolean        dest_has_alpha,
-		const guchar   *src_buf,
-		int             src_width,
-		int             src_height,
-		int             src_rowstride,
-		int             src_channels,
-		gboolean        src_has_alpha,
-		double          scale_x,
-		double          scale_y,
-		int             check_x,
-		int             check_y,
-		int             check_size,
-		guint32         color1,
-		guint32         color2,
-		PixopsFilter   *filter,
-		PixopsLineFunc  line_func,
-		PixopsPixelFunc pixel_func)
+pixops_process_rows (const PixopsProcess *p,
+		     int                  first_row,
+		     int                  last_row)
 {
+  PixopsFilter *filter = p->filter;
   int i, j;
   int x, y;			/* X and Y position in source (fixed_point) */
   
   guchar **line_bufs = g_new (guchar *, filter->y.n);
-  int *filter_weights = make_filter_table (filter);
-
-  int x_step = (1 << SCALE_SHIFT) / scale_x; /* X step in source (fixed point) */
-  int y_step = (1 << SCALE_SHIFT) / scale_y; /* Y step in source (fixed point) */
-
-  int check_shift = check_size ? get_check_shift (check_size) : 0;
 
-  int scaled_x_offset = floor (filter->x.offset * (1 << SCALE_SHIFT));
-
-  /* Compute the index where we run off the end of the source buffer. The
-   * furthest source pixel we access at index i is:
-   *
-   *  ((render_x0 + i) * x_step + scaled_x_offset) >> SCALE_SHIFT + filter->x.n - 1
-   *
-   * So, run_end_index is the smallest i for which this pixel is src_width,
-   * i.e, for which:
-   *
-   *  (i + render_x0) * x_step >= ((src_width - filter->x.n + 1) << SCALE_SHIFT) - scaled_x_offset
-   *
-   */
-#define MYDIV(a,b) ((a) > 0 ? (a) / (b) : ((a) - (b) + 1) / (b))    /* Division so that -1/5 = -1 */
-  
-  int run_end_x = (((src_width - filter->x.n + 1) << SCALE_SHIFT) - scaled_x_offset);
-  int run_end_index = MYDIV (run_end_x + x_step - 1, x_step) - render_x0;
-  run_end_index = MIN (run_end_index, render_x1 - render_x0);
-
-  y = render_y0 * y_step + floor (filter->y.offset * (1 << SCALE_SHIFT));
-  for (i = 0; i < (render_y1 - render_y0); i++)
+  y = p->y_start + first_row * p->y_step;
+  for (i = first_row; i < last_row; i++)
     {
       int dest_x;
       int y_start = y >> SCALE_SHIFT;
       int x_start;
-      int *run_weights = filter_weights +
+      int *run_weights = p->filter_weights +
                          ((y >> (SCALE_SHIFT - SUBSAMPLE_BITS)) & SUBSAMPLE_MASK) *
                          filter->x.n * filter->y.n * SUBSAMPLE;
       guchar *new_outbuf;
       guint32 tcolor1, tcolor2;
       
-      guchar *outbuf = dest_buf + dest_rowstride * i;
-      guchar *outbuf_end = outbuf + dest_channels * (render_x1 - render_x0);
+      guchar *outbuf = p->dest_buf + p->dest_rowstride * i;
+      guchar *outbuf_end = outbuf + p->dest_channels * (p->render_x1 - p->render_x0);
 
-      if (((i + check_y) >> check_shift) & 1)
+      if (((i + p->check_y) >> p->check_shift) & 1)
 	{
-	  tcolor1 = color2;
-	  tcolor2 = color1;
+	  tcolor1 = p->color2;
+	  tcolor2 = p->color1;
 	}
       else
 	{
-	  tcolor1 = color1;
-	  tcolor2 = color2;
+	  tcolor1 = p->color1;
+	  tcolor2 = p->color2;
 	}
 
       for (j=0; j<filter->y.n; j++)
 	{
 	  if (y_start <  0)
-	    line_bufs[j] = (guchar *)src_buf;
-	  else if (y_start < src_height)
-	    line_bufs[j] = (guchar *)src_buf + src_rowstride * y_start;
+	    line_bufs[j] = (guchar *)p->src_buf;
+	  else if (y_start < p->src_height)
+	    line_bufs[j] = (guchar *)p->src_buf + p->src_rowstride * y_start;
 	  else
-	    line_bufs[j] = (guchar *)src_buf + src_rowstride * (src_height - 1);
+	    line_bufs[j] = (guchar *)p->src_buf + p->src_rowstride * (p->src_height - 1);
 
 	  y_start++;
 	}
 
-      dest_x = check_x;
-      x = render_x0 * x_step + scaled_x_offset;
+      dest_x = p->check_x;
+      x = p->render_x0 * p->x_step + p->scaled_x_offset;
       x_start = x >> SCALE_SHIFT;
 
       while (x_start < 0 && outbuf < outbuf_end)
 	{
 	  process_pixel (run_weights + ((x >> (SCALE_SHIFT - SUBSAMPLE_BITS)) & SUBSAMPLE_MASK) * (filter->x.n * filter->y.n), filter->x.n, filter->y.n,
-			 outbuf, dest_x, dest_channels, dest_has_alpha,
-			 line_bufs, src_channels, src_has_alpha,
-			 x >> SCALE_SHIFT, src_width,
-			 check_size, tcolor1, tcolor2, pixel_func);
+			 outbuf, dest_x, p->dest_channels, p->dest_has_alpha,
+			 line_bufs, p->src_channels, p->src_has_alpha,
+			 x >> SCALE_SHIFT, p->src_width,
+			 p->check_size, tcolor1, tcolor2, p->pixel_func);
 	  
-	  x += x_step;
+	  x += p->x_step;
 	  x_start = x >> SCALE_SHIFT;
 	  dest_x++;
-	  outbuf += dest_channels;
+	  outbuf += p->dest_channels;
 	}
 
-      new_outbuf = (*line_func) (run_weights, filter->x.n, filter->y.n,
-				 outbuf, dest_x, dest_buf + dest_rowstride *
-				 i + run_end_index * dest_channels,
-				 dest_channels, dest_has_alpha,
-				 line_bufs, src_channels, src_has_alpha,
-				 x, x_step, src_width, check_size, tcolor1,
-				 tcolor2);
+      new_outbuf = (*p->line_func) (run_weights, filter->x.n, filter->y.n,
+				    outbuf, dest_x, p->dest_buf + p->dest_rowstride *
+				    i + p->run_end_index * p->dest_channels,
+				    p->dest_channels, p->dest_has_alpha,
+				    line_bufs, p->src_channels, p->src_has_alpha,
+				    x, p->x_step, p->src_width, p->check_size, tcolor1,
+				    tcolor2);
 
-      dest_x += (new_outbuf - outbuf) / dest_channels;
+      dest_x += (new_outbuf - outbuf) / p->dest_channels;
 
-      x = (dest_x - check_x + render_x0) * x_step + scaled_x_offset;
+      x = (dest_x - p->check_x + p->render_x0) * p->x_step + p->scaled_x_offset;
       outbuf = new_outbuf;
 
       while (outbuf < outbuf_end)
 	{
 	  process_pixel (run_weights + ((x >> (SCALE_SHIFT - SUBSAMPLE_BITS)) & SUBSAMPLE_MASK) * (filter->x.n * filter->y.n), filter->x.n, filter->y.n,
-			 outbuf, dest_x, dest_channels, dest_has_alpha,
-			 line_bufs, src_channels, src_has_alpha,
-			 x >> SCALE_SHIFT, src_width,
-			 check_size, tcolor1, tcolor2, pixel_func);
+			 outbuf, dest_x, p->dest_channels, p->dest_has_alpha,
+			 line_bufs, p->src_channels, p->src_has_alpha,
+			 x >> SCALE_SHIFT, p->src_width,
+			 p->check_size, tcolor1, tcolor2, p->pixel_func);
 	  
-	  x += x_step;
+	  x += p->x_step;
 	  dest_x++;
-	  outbuf += dest_channels;
+	  outbuf += p->dest_channels;
 	}
 
-      y += y_step;
+      y += p->y_step;
     }
 
   g_free (line_bufs);
-  g_free (filter_weights);
+}
+
+/* Multi-threaded processing
+ *
+ * When enabled, the destination is cut into horizontal bands that are
+ * rendered in parallel by a thread pool; the calling thread renders the
+ * first band itself and then waits for the others. This is opt-in, with
+ * the GDK_PIXBUF_THREADS environment variable or _pixops_set_n_threads(),
+ * and only happens if the application initialized GLib threads.
+ */
+
+/* Don't bother for less work than this, counted in filter taps */
+#define PIXOPS_THREADED_MIN_WORK (1 << 20)
+#define PIXOPS_THREADED_MIN_ROWS 16
+#define PIXOPS_MAX_THREADS 64
+
+typedef struct _PixopsBandSync PixopsBandSync;
+typedef struct _PixopsBand PixopsBand;
+
+struct _PixopsBandSync
+{
+  GMutex *mutex;
+  GCond *cond;
+  int pending;
+};
+
+struct _PixopsBand
+{
+  const PixopsProcess *process;
+  int first_row;
+  int last_row;
+  PixopsBandSync *sync;
+};
+
+G_LOCK_DEFINE_STATIC (pixops_threads);
+static int pixops_n_threads = -1;
+static GThreadPool *pixops_pool = NULL;
+
+void
+_pixops_set_n_threads (int n_threads)
+{
+  G_LOCK (pixops_threads);
+  pixops_n_threads = CLAMP (n_threads, 1, PIXOPS_MAX_THREADS);
+  if (pixops_pool)
+    g_thread_pool_set_max_threads (pixops_pool, pixops_n_threads - 1, NULL);
+  G_UNLOCK (pixops_threads);
+}
+
+static void
+pixops_band_func (gpointer data,
+		  gpointer user_data)
+{
+  PixopsBand *band = data;
+  PixopsBandSync *sync = band->sync;
+
+  pixops_process_rows (band->process, band->first_row, band->last_row);
+
+  g_mutex_lock (sync->mutex);
+  if (--sync->pending == 0)
+    g_cond_signal (sync->cond);
+  g_mutex_unlock (sync->mutex);
+}
+
+/* Returns the thread pool to use for n_rows rows of work, and the
+ * number of threads it may use, or NULL if the work should stay on the
+ * calling thread.
+ */
+static GThreadPool *
+pixops_get_pool (int     n_rows,
+		 gint64  work,
+		 int    *n_threads)
+{
+  GThreadPool *pool = NULL;
+
+  if (!g_threads_got_initialized ||
+      n_rows < 2 * PIXOPS_THREADED_MIN_ROWS ||
+      work < PIXOPS_THREADED_MIN_WORK)
+    return NULL;
+
+  G_LOCK (pixops_threads);
+
+  if (pixops_n_threads < 0)
+    {
+      const char *env = g_getenv ("GDK_PIXBUF_THREADS");
+
+      pixops_n_threads = env ? CLAMP (atoi (env), 1, PIXOPS_MAX_THREADS) : 1;
+    }
+
+  if (pixops_n_threads > 1)
+    {
+      if (!pixops_pool)
+	pixops_pool = g_thread_pool_new (pixops_band_func, NULL,
+					 pixops_n_threads - 1, FALSE, NULL);
+      pool = pixops_pool;
+      *n_threads = MIN (pixops_n_threads, n_rows / PIXOPS_THREADED_MIN_ROWS);
+    }
+
+  G_UNLOCK (pixops_threads);
+
+  return pool;
+}
+
+static void
+pixops_process (guchar         *dest_buf,
+		int             render_x0,
+		int             render_y0,
+		int             render_x1,
+		int             render_y1,
+		int             dest_rowstride,
+		int             dest_channels,
+		gboolean        dest_has_alpha,
+		const guchar   *src_buf,
+		int             src_width,
+		int             src_height,
+		int             src_rowstride,
+		int             src_channels,
+		gboolean        src_has_alpha,
+		double          scale_x,
+		double          scale_y,
+		int             check_x,
+		int             check_y,
+		int             check_size,
+		guint32         color1,
+		guint32         color2,
+		PixopsFilterEntry *entry,
+		PixopsLineFunc  line_func,
+		PixopsPixelFunc pixel_func)
+{
+  PixopsFilter *filter = &entry->filter;
+  PixopsProcess p;
+  GThreadPool *pool;
+  int n_rows = render_y1 - render_y0;
+  int n_threads = 1;
+  int run_end_x;
+
+  p.dest_buf = dest_buf;
+  p.render_x0 = render_x0;
+  p.render_x1 = render_x1;
+  p.dest_rowstride = dest_rowstride;
+  p.dest_channels = dest_channels;
+  p.dest_has_alpha = dest_has_alpha;
+  p.src_buf = src_buf;
+  p.src_width = src_width;
+  p.src_height = src_height;
+  p.src_rowstride = src_rowstride;
+  p.src_channels = src_channels;
+  p.src_has_alpha = src_has_alpha;
+  p.check_x = check_x;
+  p.check_y = check_y;
+  p.check_size = check_size;
+  p.color1 = color1;
+  p.color2 = color2;
+  p.filter = filter;
+  p.line_func = line_func;
+  p.pixel_func = pixel_func;
+
+  p.filter_weights = entry->weights;
+
+  p.x_step = (1 << SCALE_SHIFT) / scale_x; /* X step in source (fixed point) */
+  p.y_step = (1 << SCALE_SHIFT) / scale_y; /* Y step in source (fixed point) */
+
+  p.check_shift = check_size ? get_check_shift (check_size) : 0;
+
+  p.scaled_x_offset = floor (filter->x.offset * (1 << SCALE_SHIFT));
+
+  /* Compute the index where we run off the end of the source buffer. The
+   * furthest source pixel we access at index i is:
+   *
+   *  ((render_x0 + i) * x_step + scaled_x_offset) >> SCALE_SHIFT + filter->x.n - 1
+   *
+   * So, run_end_index is the smallest i for which this pixel is src_width,
+   * i.e, for which:
+   *
+   *  (i + render_x0) * x_step >= ((src_width - filter->x.n + 1) << SCALE_SHIFT) - scaled_x_offset
+   *
+   */
+#define MYDIV(a,b) ((a) > 0 ? (a) / (b) : ((a) - (b) + 1) / (b))    /* Division so that -1/5 = -1 */
+  
+  run_end_x = (((src_width - filter->x.n + 1) << SCALE_SHIFT) - p.scaled_x_offset);
+  p.run_end_index = MYDIV (run_end_x + p.x_step - 1, p.x_step) - render_x0;
+  p.run_end_index = MIN (p.run_end_index, render_x1 - render_x0);
+
+  p.y_start = render_y0 * p.y_step + floor (filter->y.offset * (1 << SCALE_SHIFT));
+
+  pool = pixops_get_pool (n_rows,
+			  (gint64) n_rows * (render_x1 - render_x0) * filter->x.n * filter->y.n,
+			  &n_threads);
+
+  if (pool && n_threads > 1)
+    {
+      PixopsBand *bands = g_new (PixopsBand, n_threads);
+      PixopsBandSync sync;
+      int k;
+
+      sync.mutex = g_mutex_new ();
+      sync.cond = g_cond_new ();
+      sync.pending = n_threads - 1;
+
+      for (k = 0; k < n_threads; k++)
+	{
+	  bands[k].process = &p;
+	  bands[k].first_row = (n_rows * k) / n_threads;
+	  bands[k].last_row = (n_rows * (k + 1)) / n_threads;
+	  bands[k].sync = &sync;
+
+	  if (k > 0)
+	    g_thread_pool_push (pool, &bands[k], NULL);
+	}
+
+      pixops_process_rows (&p, bands[0].first_row, bands[0].last_row);
+
+      g_mutex_lock (sync.mutex);
+      while (sync.pending > 0)
+	g_cond_wait (sync.cond, sync.mutex);
+      g_mutex_unlock (sync.mutex);
+
+      g_mutex_free (sync.mutex);
+      g_cond_free (sync.cond);
+      g_free (bands);
+    }
+  else
+    pixops_process_rows (&p, 0, n_rows);
 }
 
 /* Compute weights for reconstruction by replication followed by
@@ -1576,6 +1813,166 @@ make_weights (PixopsFilter     *filter,
     }
 }
 
+/* Filter cache
+ *
+ * Building a filter means computing the weights along both axes and the
+ * combined integer table from them, which shows up when many small
+ * images are scaled by the same factors, as for thumbnails or animation
+ * frames. The most recently used filters are kept, keyed by everything
+ * that goes into them. Entries are reference counted, so an entry that
+ * is evicted while another thread still renders with it stays alive
+ * until that thread is done.
+ */
+
+#define PIXOPS_FILTER_CACHE_LENGTH 16
+/* Filters for extreme reductions are huge and unlikely to be reused */
+#define PIXOPS_FILTER_CACHE_MAX_ENTRY_SIZE (256 * 1024)
+
+G_LOCK_DEFINE_STATIC (filter_cache);
+static GList *filter_cache = NULL;	/* most recently used first */
+static guint filter_cache_length = 0;
+static PixopsFilterCacheStats filter_cache_stats = { 0, };
+
+static void
+pixops_filter_entry_free (PixopsFilterEntry *entry)
+{
+  g_free (entry->filter.x.weights);
+  g_free (entry->filter.y.weights);
+  g_free (entry->weights);
+  g_free (entry);
+}
+
+static void
+pixops_filter_unref (PixopsFilterEntry *entry)
+{
+  gboolean last;
+
+  G_LOCK (filter_cache);
+  last = --entry->ref_count == 0;
+  G_UNLOCK (filter_cache);
+
+  if (last)
+    pixops_filter_entry_free (entry);
+}
+
+static PixopsFilterEntry *
+filter_cache_lookup (PixopsInterpType interp_type,
+		     double           scale_x,
+		     double           scale_y,
+		     int              overall_alpha)
+{
+  GList *l;
+
+  for (l = filter_cache; l; l = l->next)
+    {
+      PixopsFilterEntry *entry = l->data;
+
+      if (entry->interp_type == interp_type &&
+	  entry->scale_x == scale_x &&
+	  entry->scale_y == scale_y &&
+	  entry->overall_alpha == overall_alpha)
+	{
+	  if (l != filter_cache)
+	    {
+	      filter_cache = g_list_remove_link (filter_cache, l);
+	      filter_cache = g_list_concat (l, filter_cache);
+	    }
+
+	  entry->ref_count++;
+
+	  return entry;
+	}
+    }
+
+  return NULL;
+}
+
+/* Returns a reference to the filter for the given parameters, from the
+ * cache if possible. Release it with pixops_filter_unref().
+ */
+static PixopsFilterEntry *
+pixops_filter_get (PixopsInterpType interp_type,
+		   double           scale_x,
+		   double           scale_y,
+		   int              overall_alpha)
+{
+  PixopsFilterEntry *entry, *cached, *evicted = NULL;
+
+  G_LOCK (filter_cache);
+  entry = filter_cache_lookup (interp_type, scale_x, scale_y, overall_alpha);
+  if (entry)
+    filter_cache_stats.hits++;
+  else
+    filter_cache_stats.misses++;
+  G_UNLOCK (filter_cache);
+
+  if (entry)
+    return entry;
+
+  entry = g_new (PixopsFilterEntry, 1);
+  entry->interp_type = interp_type;
+  entry->scale_x = scale_x;
+  entry->scale_y = scale_y;
+  entry->overall_alpha = overall_alpha;
+  entry->ref_count = 1;
+
+  entry->filter.overall_alpha = overall_alpha / 255.;
+  make_weights (&entry->filter, interp_type, scale_x, scale_y);
+  entry->weights = make_filter_table (&entry->filter);
+  entry->size = SUBSAMPLE * (entry->filter.x.n + entry->filter.y.n) * sizeof (double) +
+                SUBSAMPLE * SUBSAMPLE * entry->filter.x.n * entry->filter.y.n * sizeof (int);
+
+  if (entry->size > PIXOPS_FILTER_CACHE_MAX_ENTRY_SIZE)
+    return entry;
+
+  G_LOCK (filter_cache);
+
+  /* Another thread may have built the same filter meanwhile */
+  cached = filter_cache_lookup (interp_type, scale_x, scale_y, overall_alpha);
+  if (cached)
+    {
+      G_UNLOCK (filter_cache);
+      pixops_filter_entry_free (entry);
+
+      return cached;
+    }
+
+  entry->ref_count++;
+  filter_cache = g_list_prepend (filter_cache, entry);
+  filter_cache_length++;
+  filter_cache_stats.size += entry->size;
+
+  if (filter_cache_length > PIXOPS_FILTER_CACHE_LENGTH)
+    {
+      GList *last = g_list_last (filter_cache);
+
+      evicted = last->data;
+      filter_cache = g_list_delete_link (filter_cache, last);
+      filter_cache_length--;
+      filter_cache_stats.size -= evicted->size;
+      filter_cache_stats.evictions++;
+
+      if (--evicted->ref_count > 0)
+	evicted = NULL;
+    }
+
+  G_UNLOCK (filter_cache);
+
+  if (evicted)
+    pixops_filter_entry_free (evicted);
+
+  return entry;
+}
+
+void
+_pixops_get_filter_cache_stats (PixopsFilterCacheStats *stats)
+{
+  G_LOCK (filter_cache);
+  *stats = filter_cache_stats;
+  stats->n_entries = filter_cache_length;
+  G_UNLOCK (filter_cache);
+}
+
 static void
 _pixops_composite_color_real (guchar          *dest_buf,
 			      int              render_x0,
@@ -1601,7 +1998,7 @@ _pixops_composite_color_real (guchar          *dest_buf,
 			      guint32          color1,
 			      guint32          color2)
 {
-  PixopsFilter filter;
+  PixopsFilterEntry *entry;
   PixopsLineFunc line_func;
   
 #ifdef USE_MMX
@@ -1626,11 +2023,10 @@ _pixops_composite_color_real (guchar          *dest_buf,
       return;
     }
   
-  filter.overall_alpha = overall_alpha / 255.;
-  make_weights (&filter, interp_type, scale_x, scale_y);
+  entry = pixops_filter_get (interp_type, scale_x, scale_y, overall_alpha);
 
 #ifdef USE_MMX
-  if (filter.x.n == 2 && filter.y.n == 2 &&
+  if (entry->filter.x.n == 2 && entry->filter.y.n == 2 &&
       dest_channels == 4 && src_channels == 4 &&
       src_has_alpha && !dest_has_alpha && found_mmx)
     line_func = composite_line_color_22_4a4_mmx_stub;
@@ -1642,10 +2038,9 @@ _pixops_composite_color_real (guchar          *dest_buf,
 		  dest_rowstride, dest_channels, dest_has_alpha,
 		  src_buf, src_width, src_height, src_rowstride, src_channels,
 		  src_has_alpha, scale_x, scale_y, check_x, check_y, check_size, color1, color2,
-		  &filter, line_func, composite_pixel_color);
+		  entry, line_func, composite_pixel_color);
 
-  g_free (filter.x.weights);
-  g_free (filter.y.weights);
+  pixops_filter_unref (entry);
 }
 
 void
@@ -1753,7 +2148,7 @@ _pixops_composite_real (guchar          *dest_buf,
 			PixopsInterpType interp_type,
 			int              overall_alpha)
 {
-  PixopsFilter filter;
+  PixopsFilterEntry *entry;
   PixopsLineFunc line_func;
   
 #ifdef USE_MMX
@@ -1776,10 +2171,9 @@ _pixops_composite_real (guchar          *dest_buf,
       return;
     }
   
-  filter.overall_alpha = overall_alpha / 255.;
-  make_weights (&filter, interp_type, scale_x, scale_y);
+  entry = pixops_filter_get (interp_type, scale_x, scale_y, overall_alpha);
 
-  if (filter.x.n == 2 && filter.y.n == 2 && dest_channels == 4 &&
+  if (entry->filter.x.n == 2 && entry->filter.y.n == 2 && dest_channels == 4 &&
       src_channels == 4 && src_has_alpha && !dest_has_alpha)
     {
 #ifdef USE_MMX
@@ -1796,10 +2190,9 @@ _pixops_composite_real (guchar          *dest_buf,
 		  dest_rowstride, dest_channels, dest_has_alpha,
 		  src_buf, src_width, src_height, src_rowstride, src_channels,
 		  src_has_alpha, scale_x, scale_y, 0, 0, 0, 0, 0, 
-		  &filter, line_func, composite_pixel);
+		  entry, line_func, composite_pixel);
 
-  g_free (filter.x.weights);
-  g_free (filter.y.weights);
+  pixops_filter_unref (entry);
 }
 
 void
@@ -2159,7 +2552,7 @@ _pixops_scale_real (guchar        *dest_buf,
 		    double         scale_y,
 		    PixopsInterpType  interp_type)
 {
-  PixopsFilter filter;
+  PixopsFilterEntry *entry;
   PixopsLineFunc line_func;
 
 #ifdef USE_MMX
@@ -2183,10 +2576,9 @@ _pixops_scale_real (guchar        *dest_buf,
       return;
     }
   
-  filter.overall_alpha = 1.0;
-  make_weights (&filter, interp_type, scale_x, scale_y);
+  entry = pixops_filter_get (interp_type, scale_x, scale_y, 255);
 
-  if (filter.x.n == 2 && filter.y.n == 2 && dest_channels == 3 && src_channels == 3)
+  if (entry->filter.x.n == 2 && entry->filter.y.n == 2 && dest_channels == 3 && src_channels == 3)
     {
 #ifdef USE_MMX
       if (found_mmx)
@@ -2202,10 +2594,9 @@ _pixops_scale_real (guchar        *dest_buf,
 		  dest_rowstride, dest_channels, dest_has_alpha,
 		  src_buf, src_width, src_height, src_rowstride, src_channels,
 		  src_has_alpha, scale_x, scale_y, 0, 0, 0, 0, 0,
-		  &filter, line_func, scale_pixel);
+		  entry, line_func, scale_pixel);
 
-  g_free (filter.x.weights);
-  g_free (filter.y.weights);
+  pixops_filter_unref (entry);
 }
 
 void
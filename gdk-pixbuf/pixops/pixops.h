@@ -117,4 +117,22 @@ void _pixops_scale    (guchar          *dest_buf,
                        double           scale_x,
                        double           scale_y,
                        PixopsInterpType interp_type);
+
+/* Sets the number of threads the filtered scale and composite functions
+ * may split large images across. The default is 1, or the value of the
+ * GDK_PIXBUF_THREADS environment variable. Threads are only used if
+ * g_thread_init() has been called.
+ */
+void _pixops_set_n_threads (int n_threads);
+
+/* Statistics of the cache of filters kept between calls */
+typedef struct {
+  guint hits;
+  guint misses;
+  guint evictions;
+  guint n_entries;
+  gsize size;		/* bytes used by the cached filters */
+} PixopsFilterCacheStats;
+
+void _pixops_get_filter_cache_stats (PixopsFilterCacheStats *stats);
 #endif
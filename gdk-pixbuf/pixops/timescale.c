@@ -21,6 +21,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 
 #include "pixops.h"
 
@@ -115,6 +118,131 @@ dump_array (double times[3][3][4])
 }
 
 #define ITERS 10
+#define THREADS_ITERS 3
+
+static void
+dump_filter_cache_stats (void)
+{
+  PixopsFilterCacheStats stats;
+
+  _pixops_get_filter_cache_stats (&stats);
+  printf ("Filter cache: %u hits, %u misses, %u evictions, %u entries (%lu bytes)\n",
+	  stats.hits, stats.misses, stats.evictions, stats.n_entries,
+	  (unsigned long) stats.size);
+}
+
+static void
+fill_pattern (guchar *buf, int len)
+{
+  guint32 seed = 1;
+  int i;
+
+  for (i = 0; i < len; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      buf[i] = seed >> 24;
+    }
+}
+
+static void
+run_threaded (guchar *dest_buf, int dest_width, int dest_height,
+	      int dest_rowstride, int dest_channels, int dest_has_alpha,
+	      const guchar *src_buf, int src_width, int src_height,
+	      int src_rowstride, int src_channels, int src_has_alpha,
+	      PixopsInterpType interp_type)
+{
+  if (src_has_alpha)
+    _pixops_composite (dest_buf, dest_width, dest_height, dest_rowstride,
+		       dest_channels, dest_has_alpha, src_buf, src_width,
+		       src_height, src_rowstride, src_channels, src_has_alpha,
+		       0, 0, dest_width, dest_height, 0, 0,
+		       (double)dest_width / src_width,
+		       (double)dest_height / src_height,
+		       interp_type, 255);
+  else
+    _pixops_scale (dest_buf, dest_width, dest_height, dest_rowstride,
+		   dest_channels, dest_has_alpha, src_buf, src_width,
+		   src_height, src_rowstride, src_channels, src_has_alpha,
+		   0, 0, dest_width, dest_height, 0, 0,
+		   (double)dest_width / src_width,
+		   (double)dest_height / src_height,
+		   interp_type);
+}
+
+/* Times the filtered scalers with 1 to max_threads threads, and checks
+ * that every thread count produces the same pixels as a single thread.
+ */
+static void
+threads_profile (int max_threads,
+		 int src_width, int src_height,
+		 int dest_width, int dest_height)
+{
+  int src_index, n_threads, i;
+  PixopsInterpType interp_type;
+
+  printf ("Scaling from (%d, %d) to (%d, %d) with up to %d threads\n\n",
+	  src_width, src_height, dest_width, dest_height, max_threads);
+
+  for (src_index = 0; src_index < 2; src_index++)
+    for (interp_type = PIXOPS_INTERP_BILINEAR; interp_type <= PIXOPS_INTERP_HYPER; interp_type++)
+      {
+	int channels = (src_index == 0) ? 3 : 4;
+	int has_alpha = (src_index == 1);
+	int src_rowstride = (channels * src_width + 3) & ~3;
+	int dest_rowstride = (channels * dest_width + 3) & ~3;
+	guchar *src_buf = g_malloc (src_rowstride * src_height);
+	guchar *dest_buf = g_malloc (dest_rowstride * dest_height);
+	guchar *ref_buf = g_malloc (dest_rowstride * dest_height);
+	double base_msecs = 0;
+
+	fill_pattern (src_buf, src_rowstride * src_height);
+
+	printf ("%s, %s\n", has_alpha ? "composite 4a" : "scale 3",
+		interp_type == PIXOPS_INTERP_HYPER ? "HYPER" : "BILINEAR");
+	printf ("\tthreads\tmsecs/iter\tspeedup\toutput\n");
+
+	for (n_threads = 1; n_threads <= max_threads; n_threads++)
+	  {
+	    GTimeVal start, stop;
+	    double msecs;
+	    gboolean identical = TRUE;
+
+	    _pixops_set_n_threads (n_threads);
+
+	    memset (dest_buf, 0x80, dest_rowstride * dest_height);
+	    run_threaded (dest_buf, dest_width, dest_height, dest_rowstride,
+			  channels, FALSE, src_buf, src_width, src_height,
+			  src_rowstride, channels, has_alpha, interp_type);
+	    if (n_threads == 1)
+	      memcpy (ref_buf, dest_buf, dest_rowstride * dest_height);
+	    else
+	      identical = memcmp (ref_buf, dest_buf, dest_rowstride * dest_height) == 0;
+
+	    g_get_current_time (&start);
+	    for (i = 0; i < THREADS_ITERS; i++)
+	      run_threaded (dest_buf, dest_width, dest_height, dest_rowstride,
+			    channels, FALSE, src_buf, src_width, src_height,
+			    src_rowstride, channels, has_alpha, interp_type);
+	    g_get_current_time (&stop);
+
+	    msecs = ((stop.tv_sec - start.tv_sec) * 1000. +
+		     (stop.tv_usec - start.tv_usec) / 1000.) / THREADS_ITERS;
+	    if (n_threads == 1)
+	      base_msecs = msecs;
+
+	    printf ("\t%d\t%.1f\t\t%.2f\t%s\n", n_threads, msecs,
+		    msecs > 0 ? base_msecs / msecs : 0.,
+		    identical ? "identical" : "DIFFERENT");
+	  }
+	printf ("\n");
+
+	g_free (src_buf);
+	g_free (dest_buf);
+	g_free (ref_buf);
+      }
+
+  _pixops_set_n_threads (1);
+}
 
 int main (int argc, char **argv)
 {
@@ -126,6 +254,44 @@ int main (int argc, char **argv)
   double composite_times[3][3][4];
   double composite_color_times[3][3][4];
 
+  if (argc >= 2 && strcmp (argv[1], "--threads") == 0)
+    {
+      int max_threads = 4;
+
+#ifdef _SC_NPROCESSORS_ONLN
+      max_threads = MAX (sysconf (_SC_NPROCESSORS_ONLN), 1);
+#endif
+      if (argc == 3 || argc == 7)
+	max_threads = MAX (atoi (argv[2]), 1);
+
+      if (argc == 7)
+	{
+	  src_width = atoi(argv[3]);
+	  src_height = atoi(argv[4]);
+	  dest_width = atoi(argv[5]);
+	  dest_height = atoi(argv[6]);
+	}
+      else if (argc <= 3)
+	{
+	  src_width = 3000;
+	  src_height = 2000;
+	  dest_width = 1200;
+	  dest_height = 800;
+	}
+      else
+	{
+	  fprintf (stderr, "Usage: scale --threads [max_threads [src_width src_height dest_width dest_height]]\n");
+	  exit(1);
+	}
+
+      if (!g_thread_supported ())
+	g_thread_init (NULL);
+
+      threads_profile (max_threads, src_width, src_height, dest_width, dest_height);
+      dump_filter_cache_stats ();
+      return 0;
+    }
+
   if (argc == 5)
     {
       src_width = atoi(argv[1]);
@@ -142,7 +308,8 @@ int main (int argc, char **argv)
     }
   else
     {
-      fprintf (stderr, "Usage: scale [src_width src_height dest_width dest_height]\n");
+      fprintf (stderr, "Usage: scale [src_width src_height dest_width dest_height]\n"
+	       "       scale --threads [max_threads [src_width src_height dest_width dest_height]]\n");
       exit(1);
     }
 
@@ -263,5 +430,7 @@ int main (int argc, char **argv)
 
   printf ("COMPOSITE_COLOR\n===============\n\n");
   dump_array (composite_color_times);
+
+  dump_filter_cache_stats ();
   return 0;
 }
@@ -223,6 +223,110 @@ simple_composite_test (void)
 	return success;
 }
 
+/* A looping GIF with two 32x32 frames, red and blue, shown for 100ms each */
+static const guchar two_frame_gif[] = {
+	0x47, 0x49, 0x46, 0x38, 0x39, 0x61, 0x20, 0x00, 0x20, 0x00, 0x81, 0x00,
+	0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff,
+	0xff, 0x21, 0xff, 0x0b, 0x4e, 0x45, 0x54, 0x53, 0x43, 0x41, 0x50, 0x45,
+	0x32, 0x2e, 0x30, 0x03, 0x01, 0x00, 0x00, 0x00, 0x21, 0xf9, 0x04, 0x04,
+	0x0a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20,
+	0x00, 0x00, 0x02, 0x1e, 0x84, 0x8f, 0xa9, 0xcb, 0xed, 0x0f, 0xa3, 0x9c,
+	0xb4, 0xda, 0x8b, 0xb3, 0xde, 0xbc, 0xfb, 0x0f, 0x86, 0xe2, 0x48, 0x96,
+	0xe6, 0x89, 0xa6, 0xea, 0xca, 0xb6, 0xee, 0x0b, 0x9b, 0x05, 0x00, 0x21,
+	0xf9, 0x04, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x20, 0x00, 0x00, 0x02, 0x1e, 0x8c, 0x8f, 0xa9, 0xcb, 0xed,
+	0x0f, 0xa3, 0x9c, 0xb4, 0xda, 0x8b, 0xb3, 0xde, 0xbc, 0xfb, 0x0f, 0x86,
+	0xe2, 0x48, 0x96, 0xe6, 0x89, 0xa6, 0xea, 0xca, 0xb6, 0xee, 0x0b, 0x9b,
+	0x05, 0x00, 0x3b
+};
+
+static gboolean
+frame_cache_test_one (const char *budget,
+		      gboolean expect_cached)
+{
+	GdkPixbufLoader *loader;
+	GdkPixbufAnimation *anim;
+	GdkPixbufAnimationIter *iter;
+	GdkPixbuf *first, *second, *again;
+	GTimeVal now = { 0, 0 };
+	GError *error = NULL;
+	gboolean success;
+
+	if (budget)
+		g_setenv ("GDK_PIXBUF_ANIM_FRAME_CACHE", budget, TRUE);
+	else
+		g_unsetenv ("GDK_PIXBUF_ANIM_FRAME_CACHE");
+
+	loader = gdk_pixbuf_loader_new_with_type ("gif", &error);
+	if (loader == NULL) {
+		/* Not a failure of the cache */
+		g_message ("frame_cache_test: %s, skipped", error->message);
+		g_error_free (error);
+		return TRUE;
+	}
+
+	/* Loading at a fixed size wraps the animation in a scaled one */
+	gdk_pixbuf_loader_set_size (loader, 16, 16);
+	if (!gdk_pixbuf_loader_write (loader, two_frame_gif, sizeof (two_frame_gif), &error) ||
+	    !gdk_pixbuf_loader_close (loader, &error)) {
+		g_message ("frame_cache_test: %s", error->message);
+		g_error_free (error);
+		gdk_pixbuf_loader_close (loader, NULL);
+		g_object_unref (loader);
+		return FALSE;
+	}
+
+	anim = gdk_pixbuf_loader_get_animation (loader);
+	iter = gdk_pixbuf_animation_get_iter (anim, &now);
+
+	/* Hold on to the first frame, so that a frame scaled anew can't
+	 * end up at the same address.
+	 */
+	first = g_object_ref (gdk_pixbuf_animation_iter_get_pixbuf (iter));
+
+	g_time_val_add (&now, 100 * 1000);
+	gdk_pixbuf_animation_iter_advance (iter, &now);
+	second = gdk_pixbuf_animation_iter_get_pixbuf (iter);
+
+	g_time_val_add (&now, 100 * 1000);
+	gdk_pixbuf_animation_iter_advance (iter, &now);
+	again = gdk_pixbuf_animation_iter_get_pixbuf (iter);
+
+	success = gdk_pixbuf_get_width (first) == 16 &&
+		  gdk_pixbuf_get_height (first) == 16 &&
+		  second != first &&
+		  (again == first) == expect_cached;
+
+	if (!success)
+		g_message ("frame_cache_test (budget %s): expected the frames to be %s",
+			   budget ? budget : "default",
+			   expect_cached ? "cached" : "scaled anew");
+
+	g_object_unref (first);
+	g_object_unref (iter);
+	g_object_unref (loader);
+
+	return success;
+}
+
+static gboolean
+frame_cache_test (void)
+{
+	gboolean success;
+
+	success = TRUE;
+
+	/* Each scaled frame takes 16 * 16 * 4 bytes, 1 kilobyte */
+	success &= frame_cache_test_one (NULL, TRUE);
+	success &= frame_cache_test_one ("2", TRUE);
+	success &= frame_cache_test_one ("1", FALSE);
+	success &= frame_cache_test_one ("0", FALSE);
+
+	g_unsetenv ("GDK_PIXBUF_ANIM_FRAME_CACHE");
+
+	return success;
+}
+
 int
 main (int argc, char **argv)
 {
@@ -236,6 +340,9 @@ main (int argc, char **argv)
 	if (!simple_composite_test ()) {
 		result = EXIT_FAILURE;
 	}
+	if (!frame_cache_test ()) {
+		result = EXIT_FAILURE;
+	}
 
 	return result;
 }
@@ -192,6 +192,11 @@ struct _GdkScratchImageInfo {
   gint tile_y1;
   gint tile_y2;
 
+  /* A single image of arbitrary size, kept for repeated large reads
+   * such as screenshots; see _gdk_image_get_scratch_full()
+   */
+  GdkImage *full_image;
+
   GdkScreen *screen;
 };
 
@@ -243,6 +248,9 @@ scratch_image_info_display_closed (GdkDisplay          *display,
   for (i = 0; i < image_info->n_images; i++)
     g_object_unref (image_info->static_image[i]);
 
+  if (image_info->full_image)
+    g_object_unref (image_info->full_image);
+
   g_free (image_info);
 }
 
@@ -268,6 +276,7 @@ scratch_image_info_for_depth (GdkScreen *screen,
 
   image_info->depth = depth;
   image_info->screen = screen;
+  image_info->full_image = NULL;
 
   g_signal_connect (gdk_screen_get_display (screen), "closed",
                     G_CALLBACK (scratch_image_info_display_closed),
@@ -448,5 +457,73 @@ gdk_image_new (GdkImageType  type,
 				   visual, width, height, -1);
 }
 
+
+/* Images for _gdk_image_get_scratch_full() with more pixels than this
+ * (16 MB at 32 bits per pixel) are freed after each use instead of
+ * being kept around.
+ */
+#define GDK_SCRATCH_FULL_MAX_CACHED (2048 * 2048)
+
+/**
+ * _gdk_image_get_scratch_full:
+ * @screen: a #GdkScreen
+ * @width: desired width
+ * @height: desired height
+ * @depth: depth of image
+ *
+ * Returns an image of at least @width x @height that is suitable to
+ * use on @screen. Unlike _gdk_image_get_scratch(), the size is not
+ * limited. The image is a shared memory image when possible. Images
+ * up to a fixed size are kept around and only replaced when a larger
+ * one is needed, so that repeated reads, as screen recording does,
+ * don't allocate.
+ *
+ * Return value: a scratch image, or %NULL if it could not be allocated.
+ *  Free it with g_object_unref() after use; it must not be used after
+ *  the next call to this function.
+ **/
+GdkImage *
+_gdk_image_get_scratch_full (GdkScreen *screen,
+			     gint       width,
+			     gint       height,
+			     gint       depth)
+{
+  GdkScratchImageInfo *image_info;
+  GdkImage *image;
+
+  g_return_val_if_fail (GDK_IS_SCREEN (screen), NULL);
+
+  image_info = scratch_image_info_for_depth (screen, depth);
+
+  if (image_info->full_image)
+    {
+      if (image_info->full_image->width >= width &&
+	  image_info->full_image->height >= height)
+	return g_object_ref (image_info->full_image);
+
+      /* Grow the cached image to cover both sizes if that stays
+       * within the limit
+       */
+      if ((gint64) MAX (width, image_info->full_image->width) *
+	  MAX (height, image_info->full_image->height) <= GDK_SCRATCH_FULL_MAX_CACHED)
+	{
+	  width = MAX (width, image_info->full_image->width);
+	  height = MAX (height, image_info->full_image->height);
+	}
+    }
+
+  image = _gdk_image_new_for_depth (screen, GDK_IMAGE_FASTEST, NULL,
+				    width, height, depth);
+
+  if (image && (gint64) width * height <= GDK_SCRATCH_FULL_MAX_CACHED)
+    {
+      if (image_info->full_image)
+	g_object_unref (image_info->full_image);
+      image_info->full_image = g_object_ref (image);
+    }
+
+  return image;
+}
+
 #define __GDK_IMAGE_C__
 #include "gdkaliasdef.c"
@@ -215,6 +215,10 @@ GdkImage *_gdk_image_get_scratch (GdkScreen *screen,
 				  gint	     depth,
 				  gint	    *x,
 				  gint	    *y);
+GdkImage *_gdk_image_get_scratch_full (GdkScreen *screen,
+				       gint       width,
+				       gint       height,
+				       gint       depth);
 
 GdkImage *_gdk_drawable_copy_to_image (GdkDrawable  *drawable,
 				       GdkImage     *image,
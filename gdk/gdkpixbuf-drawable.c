@@ -909,6 +909,153 @@ rgb888msb (GdkImage    *image,
     }
 }
 
+/*
+ * convert 24 and 32 bits/pixel truecolor data whose red, green and blue
+ * masks are whole bytes, in any order and with either byte order. This
+ * covers the common xRGB, xBGR and packed 24 bit layouts, which would
+ * otherwise go through convert_real_slow().
+ */
+static gboolean
+truecolor_byte_shifts (GdkImage  *image,
+		       GdkVisual *v)
+{
+  if (v->type != GDK_VISUAL_TRUE_COLOR ||
+      (image->bits_per_pixel != 24 && image->bits_per_pixel != 32))
+    return FALSE;
+
+  return (v->red_prec == 8 && v->green_prec == 8 && v->blue_prec == 8 &&
+	  v->red_shift % 8 == 0 && v->green_shift % 8 == 0 && v->blue_shift % 8 == 0 &&
+	  v->red_shift < image->bits_per_pixel &&
+	  v->green_shift < image->bits_per_pixel &&
+	  v->blue_shift < image->bits_per_pixel);
+}
+
+static inline guint32
+truecolor_get_pixel (GdkImage *image,
+		     guint8   *s)
+{
+  if (image->bits_per_pixel == 32)
+    {
+      guint32 pixel = *(guint32 *) s;
+
+#ifdef LITTLE
+      if (image->byte_order == GDK_MSB_FIRST)
+	pixel = GUINT32_SWAP_LE_BE (pixel);
+#else
+      if (image->byte_order == GDK_LSB_FIRST)
+	pixel = GUINT32_SWAP_LE_BE (pixel);
+#endif
+      return pixel;
+    }
+  else if (image->byte_order == GDK_LSB_FIRST)
+    return s[0] | (s[1] << 8) | (s[2] << 16);
+  else
+    return (s[0] << 16) | (s[1] << 8) | s[2];
+}
+
+static void
+convert_truecolor_bytes (GdkImage    *image,
+			 guchar      *pixels,
+			 int          rowstride,
+			 gboolean     alpha,
+			 int          x1,
+			 int          y1,
+			 int          x2,
+			 int          y2,
+			 GdkVisual   *v)
+{
+  int xx, yy;
+  int bpp = image->bits_per_pixel / 8;
+  int rs = v->red_shift, gs = v->green_shift, bs = v->blue_shift;
+  guint8 *srow = (guint8*)image->mem + y1 * image->bpl + x1 * bpp, *orow = pixels;
+
+  d (printf ("%d bits/pixel, byte aligned truecolor\n", image->bits_per_pixel));
+
+  for (yy = y1; yy < y2; yy++)
+    {
+      guint8 *s = srow;
+      guint8 *o = orow;
+
+      xx = x1;
+
+      if (alpha)
+	{
+	  guint32 *o32 = (guint32 *) o;
+
+	  for (; xx < x2; xx++, s += bpp)
+	    {
+	      guint32 pixel = truecolor_get_pixel (image, s);
+	      guint32 r = (pixel >> rs) & 0xff;
+	      guint32 g = (pixel >> gs) & 0xff;
+	      guint32 b = (pixel >> bs) & 0xff;
+
+#ifdef LITTLE
+	      *o32++ = r | (g << 8) | (b << 16) | 0xff000000;
+#else
+	      *o32++ = (r << 24) | (g << 16) | (b << 8) | 0xff;
+#endif
+	    }
+	}
+      else
+	{
+	  /* Pack four pixels into three 32 bit stores once the
+	   * destination is aligned
+	   */
+	  for (; xx < x2 && (GPOINTER_TO_SIZE (o) & 3); xx++, s += bpp)
+	    {
+	      guint32 pixel = truecolor_get_pixel (image, s);
+
+	      *o++ = pixel >> rs;
+	      *o++ = pixel >> gs;
+	      *o++ = pixel >> bs;
+	    }
+
+	  for (; xx + 4 <= x2; xx += 4, s += 4 * bpp, o += 12)
+	    {
+	      guint32 c[4];
+	      guint32 *o32 = (guint32 *) o;
+	      int i;
+
+	      for (i = 0; i < 4; i++)
+		{
+		  guint32 pixel = truecolor_get_pixel (image, s + i * bpp);
+		  guint32 r = (pixel >> rs) & 0xff;
+		  guint32 g = (pixel >> gs) & 0xff;
+		  guint32 b = (pixel >> bs) & 0xff;
+
+#ifdef LITTLE
+		  c[i] = r | (g << 8) | (b << 16);
+#else
+		  c[i] = (r << 16) | (g << 8) | b;
+#endif
+		}
+
+#ifdef LITTLE
+	      o32[0] = c[0] | (c[1] << 24);
+	      o32[1] = (c[1] >> 8) | (c[2] << 16);
+	      o32[2] = (c[2] >> 16) | (c[3] << 8);
+#else
+	      o32[0] = (c[0] << 8) | (c[1] >> 16);
+	      o32[1] = (c[1] << 16) | (c[2] >> 8);
+	      o32[2] = (c[2] << 24) | c[3];
+#endif
+	    }
+
+	  for (; xx < x2; xx++, s += bpp)
+	    {
+	      guint32 pixel = truecolor_get_pixel (image, s);
+
+	      *o++ = pixel >> rs;
+	      *o++ = pixel >> gs;
+	      *o++ = pixel >> bs;
+	    }
+	}
+
+      srow += image->bpl;
+      orow += rowstride;
+    }
+}
+
 /*
  * This should work correctly with any display/any endianness, but will probably
  * run quite slow
@@ -1114,7 +1261,12 @@ rgbconvert (GdkImage    *image,
 
   d (g_print ("converting using conversion function in bank %d\n", bank));
 
-  if (bank == 5)
+  if ((bank == 4 || bank == 5) && truecolor_byte_shifts (image, v))
+    {
+      convert_truecolor_bytes (image, pixels, rowstride, alpha,
+                               x, y, x + width, y + height, v);
+    }
+  else if (bank == 5)
     {
       convert_real_slow (image, pixels, rowstride,
                          x, y, x + width, y + height,                         
@@ -1133,6 +1285,18 @@ rgbconvert (GdkImage    *image,
 
 /* Exported functions */
 
+static void
+clear_image_area (GdkImage *image,
+		  gint      width,
+		  gint      height)
+{
+  gint bytes_per_line = (width * image->bits_per_pixel + 7) / 8;
+  gint y;
+
+  for (y = 0; y < height; y++)
+    memset ((guchar *) image->mem + y * image->bpl, 0, bytes_per_line);
+}
+
 /**
  * gdk_pixbuf_get_from_drawable:
  * @dest: Destination pixbuf, or %NULL if a new pixbuf should be created.
@@ -1213,6 +1377,7 @@ gdk_pixbuf_get_from_drawable (GdkPixbuf   *dest,
   GdkImage *image;
   int depth;
   int x0, y0;
+  gboolean created_dest = FALSE;
   
   /* General sanity checks */
 
@@ -1276,6 +1441,7 @@ gdk_pixbuf_get_from_drawable (GdkPixbuf   *dest,
       dest = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, width, height);
       if (dest == NULL)
         return NULL;
+      created_dest = TRUE;
     }
   
   if (dest)
@@ -1285,6 +1451,47 @@ gdk_pixbuf_get_from_drawable (GdkPixbuf   *dest,
       g_return_val_if_fail (dest_y + height <= dest->height, NULL);
     }
 
+  /* Read large areas in one go into a persistent image, which is a
+   * shared memory image where the windowing system supports it,
+   * rather than in many scratch image sized tiles.
+   */
+  if (width > GDK_SCRATCH_IMAGE_WIDTH || height > GDK_SCRATCH_IMAGE_HEIGHT)
+    {
+      image = _gdk_image_get_scratch_full (gdk_drawable_get_screen (src),
+					   width, height, depth);
+      if (image)
+	{
+	  GdkImage *copied;
+
+	  /* Only the onscreen part of a window is read; don't let the
+	   * rest show what the image held from an earlier read.
+	   */
+	  if (!GDK_IS_PIXMAP (src))
+	    clear_image_area (image, width, height);
+
+	  copied = gdk_drawable_copy_to_image (src, image,
+					       src_x, src_y,
+					       0, 0, width, height);
+
+	  if (copied)
+	    gdk_pixbuf_get_from_image (dest, copied, cmap,
+				       0, 0, dest_x, dest_y,
+				       width, height);
+
+	  g_object_unref (image);
+
+	  if (!copied)
+	    {
+	      if (created_dest)
+		g_object_unref (dest);
+
+	      return NULL;
+	    }
+
+	  return dest;
+	}
+    }
+
   for (y0 = 0; y0 < height; y0 += GDK_SCRATCH_IMAGE_HEIGHT)
     {
       gint height1 = MIN (height - y0, GDK_SCRATCH_IMAGE_HEIGHT);
@@ -324,6 +324,198 @@ miSetExtents (GdkRegion *pReg)
   g_assert(pExtents->x1 < pExtents->x2);
 }
 
+static int
+compare_ints (gconstpointer a,
+	      gconstpointer b)
+{
+  gint ia = *(const gint *) a;
+  gint ib = *(const gint *) b;
+
+  return ia < ib ? -1 : ia > ib ? 1 : 0;
+}
+
+static int
+compare_boxes_y1_x1 (gconstpointer a,
+		     gconstpointer b)
+{
+  const GdkRegionBox *ba = *(const GdkRegionBox * const *) a;
+  const GdkRegionBox *bb = *(const GdkRegionBox * const *) b;
+
+  if (ba->y1 != bb->y1)
+    return ba->y1 < bb->y1 ? -1 : 1;
+
+  return ba->x1 < bb->x1 ? -1 : ba->x1 > bb->x1 ? 1 : 0;
+}
+
+/**
+ * gdk_region_rectangles:
+ * @rectangles: an array of #GdkRectangle<!-- -->s
+ * @n_rectangles: the length of @rectangles
+ *
+ * Creates a new region containing the union of the areas of
+ * @rectangles. This is equivalent to calling
+ * gdk_region_union_with_rect() for each rectangle on an empty region,
+ * but much faster for a large number of rectangles, since the region
+ * is built in a single sweep over the sorted rectangles instead of
+ * merging each rectangle into the region separately.
+ *
+ * Return value: a new region
+ *
+ * Since: 2.18
+ **/
+GdkRegion *
+gdk_region_rectangles (const GdkRectangle *rectangles,
+		       gint                n_rectangles)
+{
+  GdkRegion *region;
+  GdkRegionBox *boxes, **sorted, **active, **merged, **tmp, *row;
+  gint *ys;
+  gint n_boxes, n_ys, n_active, n_merged, n_row;
+  gint next, band_start, band_count;
+  gint i, j;
+
+  g_return_val_if_fail (rectangles != NULL || n_rectangles == 0, NULL);
+
+  region = gdk_region_new ();
+
+  boxes = g_new (GdkRegionBox, MAX (n_rectangles, 1));
+  n_boxes = 0;
+  for (i = 0; i < n_rectangles; i++)
+    {
+      if (rectangles[i].width <= 0 || rectangles[i].height <= 0)
+	continue;
+
+      boxes[n_boxes].x1 = rectangles[i].x;
+      boxes[n_boxes].y1 = rectangles[i].y;
+      boxes[n_boxes].x2 = rectangles[i].x + rectangles[i].width;
+      boxes[n_boxes].y2 = rectangles[i].y + rectangles[i].height;
+      n_boxes++;
+    }
+
+  if (n_boxes == 0)
+    {
+      g_free (boxes);
+      return region;
+    }
+
+  /* The band boundaries are the distinct top and bottom edges */
+  ys = g_new (gint, 2 * n_boxes);
+  for (i = 0; i < n_boxes; i++)
+    {
+      ys[2 * i] = boxes[i].y1;
+      ys[2 * i + 1] = boxes[i].y2;
+    }
+  qsort (ys, 2 * n_boxes, sizeof (gint), compare_ints);
+
+  n_ys = 1;
+  for (i = 1; i < 2 * n_boxes; i++)
+    if (ys[i] != ys[n_ys - 1])
+      ys[n_ys++] = ys[i];
+
+  sorted = g_new (GdkRegionBox *, n_boxes);
+  for (i = 0; i < n_boxes; i++)
+    sorted[i] = &boxes[i];
+  qsort (sorted, n_boxes, sizeof (GdkRegionBox *), compare_boxes_y1_x1);
+
+  /* The boxes spanning the current band, kept sorted by x1 */
+  active = g_new (GdkRegionBox *, n_boxes);
+  merged = g_new (GdkRegionBox *, n_boxes);
+  row = g_new (GdkRegionBox, n_boxes);
+  n_active = 0;
+  next = 0;
+
+  band_start = 0;
+  band_count = 0;
+
+  for (i = 0; i + 1 < n_ys; i++)
+    {
+      gint y1 = ys[i];
+      gint y2 = ys[i + 1];
+
+      /* Update the set of boxes spanning [y1, y2): drop the boxes
+       * ending at y1 and merge in the ones starting there, which are
+       * next in @sorted and already ordered by x1.
+       */
+      n_merged = 0;
+      j = 0;
+      while (j < n_active ||
+	     (next < n_boxes && sorted[next]->y1 == y1))
+	{
+	  if (j < n_active && active[j]->y2 <= y1)
+	    j++;
+	  else if (j < n_active &&
+		   (next == n_boxes || sorted[next]->y1 != y1 ||
+		    active[j]->x1 <= sorted[next]->x1))
+	    merged[n_merged++] = active[j++];
+	  else
+	    merged[n_merged++] = sorted[next++];
+	}
+
+      tmp = active;
+      active = merged;
+      merged = tmp;
+      n_active = n_merged;
+
+      if (n_active == 0)
+	continue;
+
+      /* Merge the x intervals of the band into maximal boxes */
+      n_row = 0;
+      for (j = 0; j < n_active; j++)
+	{
+	  if (n_row > 0 && active[j]->x1 <= row[n_row - 1].x2)
+	    row[n_row - 1].x2 = MAX (row[n_row - 1].x2, active[j]->x2);
+	  else
+	    row[n_row++] = *active[j];
+	}
+
+      /* Coalesce with the previous band if it has identical boxes
+       * and is directly above, as miCoalesce() would.
+       */
+      if (band_count == n_row && region->rects[band_start].y2 == y1)
+	{
+	  for (j = 0; j < n_row; j++)
+	    if (region->rects[band_start + j].x1 != row[j].x1 ||
+		region->rects[band_start + j].x2 != row[j].x2)
+	      break;
+
+	  if (j == n_row)
+	    {
+	      for (j = 0; j < n_row; j++)
+		region->rects[band_start + j].y2 = y2;
+	      continue;
+	    }
+	}
+
+      if (region->numRects + n_row > region->size)
+	GROWREGION (region, MAX (2 * region->size, region->numRects + n_row));
+
+      band_start = region->numRects;
+      band_count = n_row;
+
+      for (j = 0; j < n_row; j++)
+	{
+	  GdkRegionBox *box = &region->rects[region->numRects++];
+
+	  box->x1 = row[j].x1;
+	  box->x2 = row[j].x2;
+	  box->y1 = y1;
+	  box->y2 = y2;
+	}
+    }
+
+  g_free (row);
+  g_free (merged);
+  g_free (active);
+  g_free (sorted);
+  g_free (ys);
+  g_free (boxes);
+
+  miSetExtents (region);
+
+  return region;
+}
+
 /**
  * gdk_region_destroy:
  * @region: a #GdkRegion
@@ -354,22 +546,47 @@ gdk_region_offset (GdkRegion *region,
 		   gint       x,
 		   gint       y)
 {
-  int nbox;
-  GdkRegionBox *pbox;
+  GdkRegionBox *pbox, *pboxEnd;
 
   g_return_if_fail (region != NULL);
 
+  if (x == 0 && y == 0)
+    return;
+
+  /* Moving a region keeps its bands as they are, so only the box
+   * coordinates change. Scrolling moves along one axis, which only
+   * touches half of them.
+   */
   pbox = region->rects;
-  nbox = region->numRects;
+  pboxEnd = pbox + region->numRects;
 
-  while(nbox--)
+  if (y == 0)
     {
-      pbox->x1 += x;
-      pbox->x2 += x;
-      pbox->y1 += y;
-      pbox->y2 += y;
-      pbox++;
+      for (; pbox < pboxEnd; pbox++)
+	{
+	  pbox->x1 += x;
+	  pbox->x2 += x;
+	}
+    }
+  else if (x == 0)
+    {
+      for (; pbox < pboxEnd; pbox++)
+	{
+	  pbox->y1 += y;
+	  pbox->y2 += y;
+	}
+    }
+  else
+    {
+      for (; pbox < pboxEnd; pbox++)
+	{
+	  pbox->x1 += x;
+	  pbox->x2 += x;
+	  pbox->y1 += y;
+	  pbox->y2 += y;
+	}
     }
+
   if (region->rects != &region->extents)
     {
       region->extents.x1 += x;
@@ -1555,6 +1772,31 @@ gdk_region_equal (const GdkRegion *region1,
   return TRUE;
 }
 
+/* Returns the first box of @region whose band ends below @y. Bands
+ * are sorted and do not overlap, so y2 is non-decreasing over the
+ * boxes and the search can be done by bisection, which keeps queries
+ * on large regions from scanning all of the bands above @y.
+ */
+static GdkRegionBox *
+find_band (const GdkRegion *region,
+	   gint             y)
+{
+  gint lo = 0;
+  gint hi = region->numRects;
+
+  while (lo < hi)
+    {
+      gint mid = (lo + hi) / 2;
+
+      if (region->rects[mid].y2 <= y)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  return region->rects + lo;
+}
+
 /**
  * gdk_region_point_in:
  * @region: a #GdkRegion
@@ -1578,8 +1820,10 @@ gdk_region_point_in (const GdkRegion *region,
     return FALSE;
   if (!INBOX(region->extents, x, y))
     return FALSE;
-  for (i = 0; i < region->numRects; i++)
+  for (i = find_band (region, y) - region->rects; i < region->numRects; i++)
     {
+      if (region->rects[i].y1 > y)
+	break;
       if (INBOX (region->rects[i], x, y))
 	return TRUE;
     }
@@ -1627,7 +1871,7 @@ gdk_region_rect_in (const GdkRegion    *region,
   partIn = FALSE;
 
     /* can stop when both partOut and partIn are TRUE, or we reach prect->y2 */
-  for (pbox = region->rects, pboxEnd = pbox + region->numRects;
+  for (pbox = find_band (region, ry), pboxEnd = region->rects + region->numRects;
        pbox < pboxEnd;
        pbox++)
     {
@@ -66,6 +66,8 @@ GdkRegion    * gdk_region_polygon         (const GdkPoint     *points,
                                            GdkFillRule         fill_rule);
 GdkRegion    * gdk_region_copy            (const GdkRegion    *region);
 GdkRegion    * gdk_region_rectangle       (const GdkRectangle *rectangle);
+GdkRegion    * gdk_region_rectangles      (const GdkRectangle *rectangles,
+                                           gint                n_rectangles);
 void           gdk_region_destroy         (GdkRegion          *region);
 
 void	       gdk_region_get_clipbox     (const GdkRegion    *region,
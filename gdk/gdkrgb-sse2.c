@@ -0,0 +1,450 @@
+/* GDK - The GIMP Drawing Kit
+ * Copyright (C) 1995-1997 Peter Mattis, Spencer Kimball and Josh MacDonald
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/* SSE2 converters for the common GdkRgb truecolor visuals.
+ *
+ * This file is compiled with SSE2 code generation enabled, so nothing in
+ * here may be called before _gdk_rgb_have_sse2() returned TRUE. None of
+ * the routines need aligned buffers; each row is converted with vector
+ * loads and stores as long as enough pixels remain, and the last few
+ * pixels go through the same per-pixel code as the scalar converters.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include <emmintrin.h>
+#ifdef HAVE_CPUID_H
+#include <cpuid.h>
+#endif
+
+#include "gdkrgb-sse2.h"
+
+gboolean
+_gdk_rgb_have_sse2 (void)
+{
+  static gint have_sse2 = -1;
+
+  if (have_sse2 < 0)
+    {
+      have_sse2 = FALSE;
+
+      if (!getenv ("GDK_DISABLE_SSE2"))
+        {
+#if defined (__x86_64__) || defined (_M_X64)
+          /* SSE2 is part of the x86-64 base instruction set */
+          have_sse2 = TRUE;
+#elif defined (HAVE_CPUID_H)
+          guint eax, ebx, ecx, edx;
+
+          if (__get_cpuid (1, &eax, &ebx, &ecx, &edx))
+            have_sse2 = (edx & bit_SSE2) != 0;
+#endif
+        }
+    }
+
+  return have_sse2;
+}
+
+/* Loads four packed 24-bit pixels (exactly 12 bytes) into the 32-bit
+ * lanes of a vector: R in bits 0-7, G in 8-15, B in 16-23. The top byte
+ * of each lane is garbage.
+ */
+static inline __m128i
+load_rgb4 (const guchar *p)
+{
+  guint32 tail;
+  __m128i v, lo, hi;
+
+  memcpy (&tail, p + 8, 4);
+  v = _mm_unpacklo_epi64 (_mm_loadl_epi64 ((const __m128i *) p),
+                          _mm_cvtsi32_si128 (tail));
+  lo = _mm_unpacklo_epi32 (v, _mm_srli_si128 (v, 3));
+  hi = _mm_unpacklo_epi32 (_mm_srli_si128 (v, 6), _mm_srli_si128 (v, 9));
+
+  return _mm_unpacklo_epi64 (lo, hi);
+}
+
+/* Packs the low 16 bits of the 32-bit lanes of a and b into one vector.
+ * SSE2 only has a signed saturating pack, so sign extend first.
+ */
+static inline __m128i
+pack_lo16 (__m128i a,
+           __m128i b)
+{
+  a = _mm_srai_epi32 (_mm_slli_epi32 (a, 16), 16);
+  b = _mm_srai_epi32 (_mm_slli_epi32 (b, 16), 16);
+
+  return _mm_packs_epi32 (a, b);
+}
+
+static inline __m128i
+rgb_to_565 (__m128i p)
+{
+  return _mm_or_si128 (_mm_or_si128 (_mm_slli_epi32 (_mm_and_si128 (p, _mm_set1_epi32 (0xf8)), 8),
+                                     _mm_and_si128 (_mm_srli_epi32 (p, 5), _mm_set1_epi32 (0x7e0))),
+                       _mm_and_si128 (_mm_srli_epi32 (p, 19), _mm_set1_epi32 (0x1f)));
+}
+
+void
+_gdk_rgb_convert_565_sse2 (guchar       *obuf,
+                           gint          bpl,
+                           const guchar *buf,
+                           gint          rowstride,
+                           gint          width,
+                           gint          height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    {
+      const guchar *bp2 = buf;
+      guint16 *op = (guint16 *) obuf;
+
+      for (x = 0; x + 8 <= width; x += 8)
+        {
+          __m128i p0 = rgb_to_565 (load_rgb4 (bp2));
+          __m128i p1 = rgb_to_565 (load_rgb4 (bp2 + 12));
+
+          _mm_storeu_si128 ((__m128i *) op, pack_lo16 (p0, p1));
+          bp2 += 24;
+          op += 8;
+        }
+      for (; x < width; x++)
+        {
+          guchar r = *bp2++;
+          guchar g = *bp2++;
+          guchar b = *bp2++;
+
+          *op++ = ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+        }
+
+      buf += rowstride;
+      obuf += bpl;
+    }
+}
+
+/* The dithered 565 converter in gdkrgb.c packs the three channels into
+ * 10-bit fields of one word and clamps them with a carry trick. Per
+ * channel that is v' = v + d; v' -= v' >> 5 (>> 6 for green), after which
+ * the top 5 (6) bits of v' are the output. With the channels in separate
+ * lanes the same arithmetic needs no tricks at all.
+ */
+static inline __m128i
+rgb_to_565_d (__m128i p,
+              __m128i dm)
+{
+  __m128i byte_mask = _mm_set1_epi32 (0xff);
+  __m128i r, g, b;
+
+  r = _mm_add_epi32 (_mm_and_si128 (p, byte_mask), _mm_srli_epi32 (dm, 20));
+  r = _mm_sub_epi32 (r, _mm_srli_epi32 (r, 5));
+  g = _mm_add_epi32 (_mm_and_si128 (_mm_srli_epi32 (p, 8), byte_mask),
+                     _mm_and_si128 (_mm_srli_epi32 (dm, 10), _mm_set1_epi32 (0x3ff)));
+  g = _mm_sub_epi32 (g, _mm_srli_epi32 (g, 6));
+  b = _mm_add_epi32 (_mm_and_si128 (_mm_srli_epi32 (p, 16), byte_mask),
+                     _mm_and_si128 (dm, _mm_set1_epi32 (0x3ff)));
+  b = _mm_sub_epi32 (b, _mm_srli_epi32 (b, 5));
+
+  return _mm_or_si128 (_mm_or_si128 (_mm_slli_epi32 (_mm_and_si128 (r, _mm_set1_epi32 (0xf8)), 8),
+                                     _mm_slli_epi32 (_mm_and_si128 (g, _mm_set1_epi32 (0xfc)), 3)),
+                       _mm_srli_epi32 (_mm_and_si128 (b, _mm_set1_epi32 (0xf8)), 3));
+}
+
+static inline __m128i
+load_dither4 (const guint32 *dmp,
+              gint           x,
+              gint           dm_mask)
+{
+  x &= dm_mask;
+  if (x + 4 <= dm_mask + 1)
+    return _mm_loadu_si128 ((const __m128i *) (dmp + x));
+  else
+    return _mm_setr_epi32 (dmp[x],
+                           dmp[(x + 1) & dm_mask],
+                           dmp[(x + 2) & dm_mask],
+                           dmp[(x + 3) & dm_mask]);
+}
+
+void
+_gdk_rgb_convert_565_d_sse2 (guchar        *obuf,
+                             gint           bpl,
+                             const guchar  *buf,
+                             gint           rowstride,
+                             gint           width,
+                             gint           height,
+                             gint           x_align,
+                             gint           y_align,
+                             const guint32 *dm_565,
+                             gint           dm_width_shift,
+                             gint           dm_height)
+{
+  gint dm_mask = (1 << dm_width_shift) - 1;
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    {
+      const guint32 *dmp = dm_565 + (((y + y_align) & (dm_height - 1)) << dm_width_shift);
+      const guchar *bp2 = buf;
+      guint16 *op = (guint16 *) obuf;
+
+      for (x = 0; x + 8 <= width; x += 8)
+        {
+          __m128i p0 = rgb_to_565_d (load_rgb4 (bp2),
+                                     load_dither4 (dmp, x + x_align, dm_mask));
+          __m128i p1 = rgb_to_565_d (load_rgb4 (bp2 + 12),
+                                     load_dither4 (dmp, x + x_align + 4, dm_mask));
+
+          _mm_storeu_si128 ((__m128i *) op, pack_lo16 (p0, p1));
+          bp2 += 24;
+          op += 8;
+        }
+      for (; x < width; x++)
+        {
+          gint32 rgb = *bp2++ << 20;
+          rgb += *bp2++ << 10;
+          rgb += *bp2++;
+          rgb += dmp[(x + x_align) & dm_mask];
+          rgb += 0x10040100
+            - ((rgb & 0x1e0001e0) >> 5)
+            - ((rgb & 0x00070000) >> 6);
+
+          *op++ =
+            ((rgb & 0x0f800000) >> 12) |
+            ((rgb & 0x0003f000) >> 7) |
+            ((rgb & 0x000000f8) >> 3);
+        }
+
+      buf += rowstride;
+      obuf += bpl;
+    }
+}
+
+/* Swapping R and B in packed 24-bit data: 16 pixels are exactly three
+ * vectors. Byte j of the output keeps green (j % 3 == 1), or takes the
+ * byte two to the right (j % 3 == 0) or two to the left (j % 3 == 2).
+ * The masks below select those bytes, in the phase of each of the three
+ * vectors.
+ */
+#define KEEP3 0x00, 0xff, 0x00
+#define RIGHT3 0xff, 0x00, 0x00
+#define LEFT3 0x00, 0x00, 0xff
+
+static const guchar keep_mask[48] = {
+  KEEP3, KEEP3, KEEP3, KEEP3, KEEP3, KEEP3, KEEP3, KEEP3,
+  KEEP3, KEEP3, KEEP3, KEEP3, KEEP3, KEEP3, KEEP3, KEEP3
+};
+static const guchar right_mask[48] = {
+  RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3,
+  RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3, RIGHT3
+};
+static const guchar left_mask[48] = {
+  LEFT3, LEFT3, LEFT3, LEFT3, LEFT3, LEFT3, LEFT3, LEFT3,
+  LEFT3, LEFT3, LEFT3, LEFT3, LEFT3, LEFT3, LEFT3, LEFT3
+};
+
+#undef KEEP3
+#undef RIGHT3
+#undef LEFT3
+
+static inline __m128i
+swap_rb_vector (__m128i v,
+                __m128i right,
+                __m128i left,
+                gint    k)
+{
+  __m128i keep_k = _mm_loadu_si128 ((const __m128i *) (keep_mask + 16 * k));
+  __m128i right_k = _mm_loadu_si128 ((const __m128i *) (right_mask + 16 * k));
+  __m128i left_k = _mm_loadu_si128 ((const __m128i *) (left_mask + 16 * k));
+
+  return _mm_or_si128 (_mm_or_si128 (_mm_and_si128 (v, keep_k),
+                                     _mm_and_si128 (right, right_k)),
+                       _mm_and_si128 (left, left_k));
+}
+
+void
+_gdk_rgb_convert_888_lsb_sse2 (guchar       *obuf,
+                               gint          bpl,
+                               const guchar *buf,
+                               gint          rowstride,
+                               gint          width,
+                               gint          height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    {
+      const guchar *bp2 = buf;
+      guchar *op = obuf;
+
+      for (x = 0; x + 16 <= width; x += 16)
+        {
+          __m128i v0 = _mm_loadu_si128 ((const __m128i *) bp2);
+          __m128i v1 = _mm_loadu_si128 ((const __m128i *) (bp2 + 16));
+          __m128i v2 = _mm_loadu_si128 ((const __m128i *) (bp2 + 32));
+          __m128i o0, o1, o2;
+
+          o0 = swap_rb_vector (v0,
+                               _mm_or_si128 (_mm_srli_si128 (v0, 2), _mm_slli_si128 (v1, 14)),
+                               _mm_slli_si128 (v0, 2),
+                               0);
+          o1 = swap_rb_vector (v1,
+                               _mm_or_si128 (_mm_srli_si128 (v1, 2), _mm_slli_si128 (v2, 14)),
+                               _mm_or_si128 (_mm_slli_si128 (v1, 2), _mm_srli_si128 (v0, 14)),
+                               1);
+          o2 = swap_rb_vector (v2,
+                               _mm_srli_si128 (v2, 2),
+                               _mm_or_si128 (_mm_slli_si128 (v2, 2), _mm_srli_si128 (v1, 14)),
+                               2);
+
+          _mm_storeu_si128 ((__m128i *) op, o0);
+          _mm_storeu_si128 ((__m128i *) (op + 16), o1);
+          _mm_storeu_si128 ((__m128i *) (op + 32), o2);
+          bp2 += 48;
+          op += 48;
+        }
+      for (; x < width; x++)
+        {
+          op[0] = bp2[2];
+          op[1] = bp2[1];
+          op[2] = bp2[0];
+          bp2 += 3;
+          op += 3;
+        }
+
+      buf += rowstride;
+      obuf += bpl;
+    }
+}
+
+/* The three 32-bit converters only differ in how a lane holding
+ * R | G << 8 | B << 16 is rearranged, so they share one loop.
+ */
+typedef enum {
+  CONVERT_0888,		/* B G R 0xff in memory */
+  CONVERT_0888_BR,	/* 0xff R G B in memory */
+  CONVERT_8880_BR	/* R G B 0 in memory */
+} Convert32Kind;
+
+static inline __m128i
+rgb_to_32 (__m128i       p,
+           Convert32Kind kind)
+{
+  switch (kind)
+    {
+    case CONVERT_0888:
+      return _mm_or_si128 (_mm_or_si128 (_mm_slli_epi32 (_mm_and_si128 (p, _mm_set1_epi32 (0xff)), 16),
+                                         _mm_and_si128 (p, _mm_set1_epi32 (0xff00))),
+                           _mm_or_si128 (_mm_and_si128 (_mm_srli_epi32 (p, 16), _mm_set1_epi32 (0xff)),
+                                         _mm_set1_epi32 (0xff000000)));
+    case CONVERT_0888_BR:
+      return _mm_or_si128 (_mm_slli_epi32 (p, 8), _mm_set1_epi32 (0xff));
+    case CONVERT_8880_BR:
+    default:
+      return _mm_and_si128 (p, _mm_set1_epi32 (0xffffff));
+    }
+}
+
+static inline void
+convert_32 (guchar        *obuf,
+            gint           bpl,
+            const guchar  *buf,
+            gint           rowstride,
+            gint           width,
+            gint           height,
+            Convert32Kind  kind)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    {
+      const guchar *bp2 = buf;
+      guchar *op = obuf;
+
+      for (x = 0; x + 8 <= width; x += 8)
+        {
+          _mm_storeu_si128 ((__m128i *) op, rgb_to_32 (load_rgb4 (bp2), kind));
+          _mm_storeu_si128 ((__m128i *) (op + 16), rgb_to_32 (load_rgb4 (bp2 + 12), kind));
+          bp2 += 24;
+          op += 32;
+        }
+      for (; x < width; x++)
+        {
+          switch (kind)
+            {
+            case CONVERT_0888:
+              op[0] = bp2[2];
+              op[1] = bp2[1];
+              op[2] = bp2[0];
+              op[3] = 0xff;
+              break;
+            case CONVERT_0888_BR:
+              op[0] = 0xff;
+              op[1] = bp2[0];
+              op[2] = bp2[1];
+              op[3] = bp2[2];
+              break;
+            case CONVERT_8880_BR:
+              op[0] = bp2[0];
+              op[1] = bp2[1];
+              op[2] = bp2[2];
+              op[3] = 0;
+              break;
+            }
+          bp2 += 3;
+          op += 4;
+        }
+
+      buf += rowstride;
+      obuf += bpl;
+    }
+}
+
+void
+_gdk_rgb_convert_0888_sse2 (guchar       *obuf,
+                            gint          bpl,
+                            const guchar *buf,
+                            gint          rowstride,
+                            gint          width,
+                            gint          height)
+{
+  convert_32 (obuf, bpl, buf, rowstride, width, height, CONVERT_0888);
+}
+
+void
+_gdk_rgb_convert_0888_br_sse2 (guchar       *obuf,
+                               gint          bpl,
+                               const guchar *buf,
+                               gint          rowstride,
+                               gint          width,
+                               gint          height)
+{
+  convert_32 (obuf, bpl, buf, rowstride, width, height, CONVERT_0888_BR);
+}
+
+void
+_gdk_rgb_convert_8880_br_sse2 (guchar       *obuf,
+                               gint          bpl,
+                               const guchar *buf,
+                               gint          rowstride,
+                               gint          width,
+                               gint          height)
+{
+  convert_32 (obuf, bpl, buf, rowstride, width, height, CONVERT_8880_BR);
+}
@@ -0,0 +1,79 @@
+/* GDK - The GIMP Drawing Kit
+ * Copyright (C) 1995-1997 Peter Mattis, Spencer Kimball and Josh MacDonald
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.	 See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __GDK_RGB_SSE2_H__
+#define __GDK_RGB_SSE2_H__
+
+#ifdef USE_SSE2
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/* SSE2 versions of the GdkRGB truecolor converters. They take the
+ * destination already offset to the first pixel of the area, and produce
+ * output bit-identical to the scalar converters in gdkrgb.c.
+ */
+gboolean _gdk_rgb_have_sse2            (void);
+
+void     _gdk_rgb_convert_565_sse2     (guchar        *obuf,
+                                        gint           bpl,
+                                        const guchar  *buf,
+                                        gint           rowstride,
+                                        gint           width,
+                                        gint           height);
+void     _gdk_rgb_convert_565_d_sse2   (guchar        *obuf,
+                                        gint           bpl,
+                                        const guchar  *buf,
+                                        gint           rowstride,
+                                        gint           width,
+                                        gint           height,
+                                        gint           x_align,
+                                        gint           y_align,
+                                        const guint32 *dm_565,
+                                        gint           dm_width_shift,
+                                        gint           dm_height);
+void     _gdk_rgb_convert_888_lsb_sse2 (guchar        *obuf,
+                                        gint           bpl,
+                                        const guchar  *buf,
+                                        gint           rowstride,
+                                        gint           width,
+                                        gint           height);
+void     _gdk_rgb_convert_0888_sse2    (guchar        *obuf,
+                                        gint           bpl,
+                                        const guchar  *buf,
+                                        gint           rowstride,
+                                        gint           width,
+                                        gint           height);
+void     _gdk_rgb_convert_0888_br_sse2 (guchar        *obuf,
+                                        gint           bpl,
+                                        const guchar  *buf,
+                                        gint           rowstride,
+                                        gint           width,
+                                        gint           height);
+void     _gdk_rgb_convert_8880_br_sse2 (guchar        *obuf,
+                                        gint           bpl,
+                                        const guchar  *buf,
+                                        gint           rowstride,
+                                        gint           width,
+                                        gint           height);
+
+G_END_DECLS
+
+#endif /* USE_SSE2 */
+#endif /* __GDK_RGB_SSE2_H__ */
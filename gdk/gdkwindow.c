@@ -46,6 +46,8 @@ struct _GdkWindowPaint
   gint x_offset;
   gint y_offset;
   cairo_surface_t *surface;
+  guint surface_refs;	/* references on surface right after creation */
+  guint shared : 1;	/* pixmap was handed out to the application */
 };
 
 typedef struct {
@@ -1063,6 +1065,252 @@ gdk_window_begin_paint_rect (GdkWindow          *window,
 #include "x11/gdkx.h"
 #endif
 
+/* Double-buffer pixmaps are kept in a small per-screen pool instead of
+ * being created and destroyed for every expose. Pixmaps are bucketed
+ * into size classes so that slightly different clip boxes (e.g. during
+ * smooth scrolling or animations) can share the same pixmap, and
+ * entries that have not been used for a while are released by a
+ * periodic trim.
+ */
+#define PAINT_POOL_MIN_SIZE        32
+#define PAINT_POOL_MAX_ENTRIES     4     /* free pixmaps per screen */
+#define PAINT_POOL_MAX_PIXELS      (2048 * 2048)
+#define PAINT_POOL_TRIM_INTERVAL   5000  /* milliseconds */
+
+typedef struct _GdkPaintPixmap     GdkPaintPixmap;
+typedef struct _GdkPaintPixmapPool GdkPaintPixmapPool;
+
+struct _GdkPaintPixmap
+{
+  GdkPixmap *pixmap;
+  GdkVisual *visual;
+  gint depth;
+  gint width;
+  gint height;
+  guint used : 1;
+};
+
+struct _GdkPaintPixmapPool
+{
+  GdkScreen *screen;
+  GSList *free_pixmaps;
+};
+
+static GSList *paint_pixmap_pools = NULL;
+static guint paint_pixmap_trim_timeout = 0;
+
+/* Rounds @size up to a size class; classes are a quarter of a power
+ * of two apart, so at most 25% is wasted in each dimension.
+ */
+static gint
+paint_pixmap_size_class (gint size)
+{
+  gint step;
+
+  if (size <= PAINT_POOL_MIN_SIZE)
+    return PAINT_POOL_MIN_SIZE;
+
+  step = 1;
+  while (step <= size / 2)
+    step <<= 1;
+  step = MAX (step / 4, 1);
+
+  return (size + step - 1) & ~(step - 1);
+}
+
+static void
+paint_pixmap_free (GdkPaintPixmap *entry)
+{
+  g_object_unref (entry->pixmap);
+  g_free (entry);
+}
+
+static void
+paint_pixmap_pool_free (GdkPaintPixmapPool *pool)
+{
+  g_slist_foreach (pool->free_pixmaps, (GFunc) paint_pixmap_free, NULL);
+  g_slist_free (pool->free_pixmaps);
+
+  paint_pixmap_pools = g_slist_remove (paint_pixmap_pools, pool);
+  if (paint_pixmap_pools == NULL && paint_pixmap_trim_timeout)
+    {
+      g_source_remove (paint_pixmap_trim_timeout);
+      paint_pixmap_trim_timeout = 0;
+    }
+
+  g_free (pool);
+}
+
+static GdkPaintPixmapPool *
+paint_pixmap_pool_get (GdkScreen *screen)
+{
+  GdkPaintPixmapPool *pool;
+
+  pool = g_object_get_data (G_OBJECT (screen), "gdk-paint-pixmap-pool");
+  if (!pool)
+    {
+      pool = g_new0 (GdkPaintPixmapPool, 1);
+      pool->screen = screen;
+      g_object_set_data_full (G_OBJECT (screen), "gdk-paint-pixmap-pool",
+			      pool, (GDestroyNotify) paint_pixmap_pool_free);
+      paint_pixmap_pools = g_slist_prepend (paint_pixmap_pools, pool);
+    }
+
+  return pool;
+}
+
+/* Frees every pooled pixmap that was not used since the previous trim,
+ * so that an idle application does not hold on to server memory.
+ */
+static gboolean
+paint_pixmap_trim (gpointer data)
+{
+  GSList *pools, *l, *next;
+  gboolean remaining = FALSE;
+
+  for (pools = paint_pixmap_pools; pools; pools = pools->next)
+    {
+      GdkPaintPixmapPool *pool = pools->data;
+
+      for (l = pool->free_pixmaps; l; l = next)
+	{
+	  GdkPaintPixmap *entry = l->data;
+
+	  next = l->next;
+
+	  if (entry->used)
+	    {
+	      entry->used = FALSE;
+	      remaining = TRUE;
+	    }
+	  else
+	    {
+	      pool->free_pixmaps = g_slist_delete_link (pool->free_pixmaps, l);
+	      paint_pixmap_free (entry);
+	    }
+	}
+    }
+
+  if (!remaining)
+    paint_pixmap_trim_timeout = 0;
+
+  return remaining;
+}
+
+static GdkPixmap *
+paint_pixmap_acquire (GdkWindow *window,
+		      gint       width,
+		      gint       height)
+{
+  GdkPaintPixmapPool *pool;
+  GdkPaintPixmap *entry;
+  GdkColormap *colormap;
+  GdkPixmap *pixmap;
+  GdkVisual *visual;
+  GSList *l, *best;
+  gint depth;
+
+  width = MAX (width, 1);
+  height = MAX (height, 1);
+
+  visual = gdk_drawable_get_visual (window);
+  depth = gdk_drawable_get_depth (window);
+  pool = paint_pixmap_pool_get (gdk_drawable_get_screen (window));
+
+  /* Take the smallest free pixmap that is large enough */
+  best = NULL;
+  for (l = pool->free_pixmaps; l; l = l->next)
+    {
+      entry = l->data;
+
+      if (entry->depth != depth || entry->visual != visual ||
+	  entry->width < width || entry->height < height)
+	continue;
+
+      if (!best ||
+	  entry->width * entry->height <
+	  ((GdkPaintPixmap *) best->data)->width *
+	  ((GdkPaintPixmap *) best->data)->height)
+	best = l;
+    }
+
+  if (best)
+    {
+      entry = best->data;
+      pool->free_pixmaps = g_slist_delete_link (pool->free_pixmaps, best);
+      pixmap = entry->pixmap;
+      g_free (entry);
+
+      colormap = gdk_drawable_get_colormap (window);
+      if (colormap && colormap != gdk_drawable_get_colormap (pixmap))
+	gdk_drawable_set_colormap (pixmap, colormap);
+
+      return pixmap;
+    }
+
+  width = paint_pixmap_size_class (width);
+  height = paint_pixmap_size_class (height);
+
+  return gdk_pixmap_new (window, width, height, -1);
+}
+
+/* Whether the pixmap of @paint may still be used from outside once the
+ * paint is over: it was handed out by gdk_window_get_internal_paint_info(),
+ * or a cairo context created for the window during the paint is still
+ * alive. Must be called before the paint drops its own surface reference.
+ */
+static gboolean
+paint_is_shared (GdkWindowPaint *paint)
+{
+  return paint->shared ||
+         cairo_surface_get_reference_count (paint->surface) > paint->surface_refs;
+}
+
+static void
+paint_pixmap_release (GdkPixmap *pixmap,
+		      gboolean   shared)
+{
+  GdkPaintPixmapPool *pool;
+  GdkPaintPixmap *entry;
+  gint width, height;
+
+  gdk_drawable_get_size (pixmap, &width, &height);
+
+  /* A pixmap that somebody else may still draw to must not be handed
+   * to the next paint; neither are pixmaps too large to be worth
+   * keeping around.
+   */
+  if (shared || width * height > PAINT_POOL_MAX_PIXELS)
+    {
+      g_object_unref (pixmap);
+      return;
+    }
+
+  pool = paint_pixmap_pool_get (gdk_drawable_get_screen (pixmap));
+
+  entry = g_new (GdkPaintPixmap, 1);
+  entry->pixmap = pixmap;
+  entry->visual = gdk_drawable_get_visual (pixmap);
+  entry->depth = gdk_drawable_get_depth (pixmap);
+  entry->width = width;
+  entry->height = height;
+  entry->used = TRUE;
+
+  pool->free_pixmaps = g_slist_prepend (pool->free_pixmaps, entry);
+
+  if (g_slist_length (pool->free_pixmaps) > PAINT_POOL_MAX_ENTRIES)
+    {
+      GSList *last = g_slist_last (pool->free_pixmaps);
+
+      paint_pixmap_free (last->data);
+      pool->free_pixmaps = g_slist_delete_link (pool->free_pixmaps, last);
+    }
+
+  if (!paint_pixmap_trim_timeout)
+    paint_pixmap_trim_timeout = gdk_threads_add_timeout (PAINT_POOL_TRIM_INTERVAL,
+							 paint_pixmap_trim, NULL);
+}
+
 /**
  * gdk_window_begin_paint_region:
  * @window: a #GdkWindow
@@ -1139,11 +1387,12 @@ gdk_window_begin_paint_region (GdkWindow       *window,
   paint->region = gdk_region_copy (region);
   paint->x_offset = clip_box.x;
   paint->y_offset = clip_box.y;
-  paint->pixmap =
-    gdk_pixmap_new (window,
-		    MAX (clip_box.width, 1), MAX (clip_box.height, 1), -1);
+  paint->pixmap = paint_pixmap_acquire (window,
+                                        clip_box.width, clip_box.height);
 
   paint->surface = _gdk_drawable_ref_cairo_surface (paint->pixmap);
+  paint->surface_refs = cairo_surface_get_reference_count (paint->surface);
+  paint->shared = FALSE;
   cairo_surface_set_device_offset (paint->surface,
 				   - paint->x_offset, - paint->y_offset);
   
@@ -1188,6 +1437,7 @@ gdk_window_end_paint (GdkWindow *window)
   GdkGC *tmp_gc;
   GdkRectangle clip_box;
   gint x_offset, y_offset;
+  gboolean shared;
 
   g_return_if_fail (GDK_IS_WINDOW (window));
 
@@ -1245,8 +1495,9 @@ gdk_window_end_paint (GdkWindow *window)
   /* Reset clip region of the cached GdkGC */
   gdk_gc_set_clip_region (tmp_gc, NULL);
 
+  shared = paint_is_shared (paint);
   cairo_surface_destroy (paint->surface);
-  g_object_unref (paint->pixmap);
+  paint_pixmap_release (paint->pixmap, shared);
   gdk_region_destroy (paint->region);
   g_free (paint);
 
@@ -1292,9 +1543,11 @@ gdk_window_free_paint_stack (GdkWindow *window)
       while (tmp_list)
 	{
 	  GdkWindowPaint *paint = tmp_list->data;
+	  gboolean shared;
 
-	  if (tmp_list == private->paint_stack)
-	    g_object_unref (paint->pixmap);
+	  shared = paint_is_shared (paint);
+	  cairo_surface_destroy (paint->surface);
+	  paint_pixmap_release (paint->pixmap, shared);
 		  
 	  gdk_region_destroy (paint->region);
 	  g_free (paint);
@@ -1367,6 +1620,7 @@ gdk_window_get_internal_paint_info (GdkWindow    *window,
 	{
 	  GdkWindowPaint *paint = private->paint_stack->data;
 	  *real_drawable = paint->pixmap;
+	  paint->shared = TRUE;
 	}
       else
 	*real_drawable = window;
@@ -2515,6 +2769,161 @@ static GSList *update_windows = NULL;
 static guint update_idle = 0;
 static gboolean debug_updates = FALSE;
 
+/* Sparse update regions (e.g. two small damaged corners of a large
+ * window) are split into several expose events, each painted through
+ * its own backing store, rather than painting the whole clip box.
+ */
+#define SPLIT_UPDATES_MAX_RECTANGLES 64
+
+static gdouble split_updates_min_coverage = 0.5;
+static gint split_updates_min_area = 128 * 128;
+static gint split_updates_max_passes = 4;
+
+typedef struct
+{
+  GdkRectangle extents;
+  gint covered;			/* pixels of the update area inside extents */
+  GSList *rectangles;
+} UpdateCluster;
+
+static gint
+rectangle_area (const GdkRectangle *rect)
+{
+  return rect->width * rect->height;
+}
+
+/* Groups the rectangles of @region into at most split_updates_max_passes
+ * clusters by repeatedly merging the pair of clusters whose common
+ * extents waste the fewest pixels. Returns a list of regions, or %NULL
+ * if painting @region in a single pass is preferable.
+ */
+static GSList *
+split_update_region (GdkRegion *region)
+{
+  GdkRectangle clip_box;
+  GdkRectangle *rectangles;
+  UpdateCluster *clusters;
+  GSList *result = NULL;
+  gint n_rectangles, n_clusters;
+  gint covered, total;
+  gint i, j;
+
+  if (split_updates_max_passes < 2)
+    return NULL;
+
+  gdk_region_get_clipbox (region, &clip_box);
+  if (rectangle_area (&clip_box) < split_updates_min_area)
+    return NULL;
+
+  gdk_region_get_rectangles (region, &rectangles, &n_rectangles);
+
+  covered = 0;
+  for (i = 0; i < n_rectangles; i++)
+    covered += rectangle_area (&rectangles[i]);
+
+  if (n_rectangles < 2 || n_rectangles > SPLIT_UPDATES_MAX_RECTANGLES ||
+      covered >= split_updates_min_coverage * rectangle_area (&clip_box))
+    {
+      g_free (rectangles);
+      return NULL;
+    }
+
+  clusters = g_new (UpdateCluster, n_rectangles);
+  for (i = 0; i < n_rectangles; i++)
+    {
+      clusters[i].extents = rectangles[i];
+      clusters[i].covered = rectangle_area (&rectangles[i]);
+      clusters[i].rectangles = g_slist_prepend (NULL, &rectangles[i]);
+    }
+  n_clusters = n_rectangles;
+
+  while (n_clusters > 1)
+    {
+      GdkRectangle best_extents = { 0, };
+      gint best_i = -1, best_j = -1;
+      gint best_waste = G_MAXINT;
+
+      for (i = 0; i < n_clusters; i++)
+	for (j = i + 1; j < n_clusters; j++)
+	  {
+	    GdkRectangle extents;
+	    gint waste;
+
+	    gdk_rectangle_union (&clusters[i].extents, &clusters[j].extents,
+				 &extents);
+	    waste = rectangle_area (&extents)
+	      - clusters[i].covered - clusters[j].covered;
+
+	    if (waste < best_waste)
+	      {
+		best_waste = waste;
+		best_extents = extents;
+		best_i = i;
+		best_j = j;
+	      }
+	  }
+
+      /* Stop once the cheapest merge would paint too many pixels that
+       * were not damaged, unless there are still too many passes.
+       */
+      if (n_clusters <= split_updates_max_passes &&
+	  clusters[best_i].covered + clusters[best_j].covered <
+	  split_updates_min_coverage * rectangle_area (&best_extents))
+	break;
+
+      clusters[best_i].extents = best_extents;
+      clusters[best_i].covered += clusters[best_j].covered;
+      clusters[best_i].rectangles = g_slist_concat (clusters[best_i].rectangles,
+						    clusters[best_j].rectangles);
+      clusters[best_j] = clusters[n_clusters - 1];
+      n_clusters--;
+    }
+
+  total = 0;
+  for (i = 0; i < n_clusters; i++)
+    total += rectangle_area (&clusters[i].extents);
+
+  for (i = 0; i < n_clusters; i++)
+    {
+      if (n_clusters > 1 && total < rectangle_area (&clip_box))
+	{
+	  GdkRegion *cluster_region = gdk_region_new ();
+	  GSList *l;
+
+	  for (l = clusters[i].rectangles; l; l = l->next)
+	    gdk_region_union_with_rect (cluster_region, l->data);
+
+	  result = g_slist_prepend (result, cluster_region);
+	}
+
+      g_slist_free (clusters[i].rectangles);
+    }
+
+  g_free (clusters);
+  g_free (rectangles);
+
+  return result;
+}
+
+static void
+send_expose (GdkWindow *window,
+	     GdkRegion *region,
+	     gint       count)
+{
+  GdkEvent event;
+
+  event.expose.type = GDK_EXPOSE;
+  event.expose.window = g_object_ref (window);
+  event.expose.send_event = FALSE;
+  event.expose.count = count;
+  event.expose.region = region;
+  gdk_region_get_clipbox (region, &event.expose.area);
+
+  (*_gdk_event_func) (&event, _gdk_event_data);
+
+  g_object_unref (window);
+}
+
 static gboolean
 gdk_window_update_idle (gpointer data)
 {
@@ -2599,18 +3008,29 @@ gdk_window_process_updates_internal (GdkWindow *window)
 	  if (!gdk_region_empty (expose_region) &&
 	      (private->event_mask & GDK_EXPOSURE_MASK))
 	    {
-	      GdkEvent event;
-	      
-	      event.expose.type = GDK_EXPOSE;
-	      event.expose.window = g_object_ref (window);
-	      event.expose.send_event = FALSE;
-	      event.expose.count = 0;
-	      event.expose.region = expose_region;
-	      gdk_region_get_clipbox (expose_region, &event.expose.area);
-	      
-	      (*_gdk_event_func) (&event, _gdk_event_data);
-	      
-	      g_object_unref (window);
+	      GSList *regions, *l;
+	      gint count;
+
+	      regions = split_update_region (expose_region);
+
+	      if (regions)
+		{
+		  /* Like the server, count down to 0 for the last
+		   * expose, and stop if a handler destroys the window.
+		   */
+		  g_object_ref (window);
+		  count = g_slist_length (regions);
+		  for (l = regions; l; l = l->next)
+		    {
+		      if (!GDK_WINDOW_DESTROYED (window))
+			send_expose (window, l->data, --count);
+		      gdk_region_destroy (l->data);
+		    }
+		  g_slist_free (regions);
+		  g_object_unref (window);
+		}
+	      else
+		send_expose (window, expose_region, 0);
 	    }
 
 	  if (expose_region != update_area)
@@ -3154,6 +3574,64 @@ gdk_window_set_debug_updates (gboolean setting)
   debug_updates = setting;
 }
 
+/**
+ * gdk_window_set_update_split_policy:
+ * @min_coverage: fraction of its clip box that an update region must
+ *   cover to be painted in a single pass
+ * @min_area: update regions whose clip box is smaller than this many
+ *   pixels are always painted in a single pass
+ * @max_passes: maximum number of expose events a single update
+ *   region may be split into, or a value less than 2 to disable
+ *   splitting
+ *
+ * Controls how gdk_window_process_updates() handles sparse update
+ * regions. When the invalid region of a window covers less than
+ * @min_coverage of its bounding box, GDK groups its rectangles into
+ * up to @max_passes clusters and sends a separate expose event for
+ * each, so that widgets which repaint the whole expose area and the
+ * double buffer created by gdk_window_begin_paint_region() only cover
+ * the parts that actually need redrawing.
+ *
+ * The defaults are a coverage of 0.5, an area of 128x128 pixels and
+ * 4 passes.
+ *
+ * Since: 2.18
+ **/
+void
+gdk_window_set_update_split_policy (gdouble min_coverage,
+				    gint    min_area,
+				    gint    max_passes)
+{
+  g_return_if_fail (min_coverage >= 0.0 && min_coverage <= 1.0);
+
+  split_updates_min_coverage = min_coverage;
+  split_updates_min_area = MAX (min_area, 0);
+  split_updates_max_passes = max_passes;
+}
+
+/**
+ * gdk_window_get_update_split_policy:
+ * @min_coverage: return location for the minimum coverage, or %NULL
+ * @min_area: return location for the minimum area, or %NULL
+ * @max_passes: return location for the maximum number of passes, or %NULL
+ *
+ * Retrieves the values set with gdk_window_set_update_split_policy().
+ *
+ * Since: 2.18
+ **/
+void
+gdk_window_get_update_split_policy (gdouble *min_coverage,
+				    gint    *min_area,
+				    gint    *max_passes)
+{
+  if (min_coverage)
+    *min_coverage = split_updates_min_coverage;
+  if (min_area)
+    *min_area = split_updates_min_area;
+  if (max_passes)
+    *max_passes = split_updates_max_passes;
+}
+
 /**
  * gdk_window_constrain_size:
  * @geometry: a #GdkGeometry structure
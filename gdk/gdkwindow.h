@@ -624,6 +624,13 @@ void       gdk_window_process_updates     (GdkWindow    *window,
 /* Enable/disable flicker, so you can tell if your code is inefficient. */
 void       gdk_window_set_debug_updates   (gboolean      setting);
 
+void       gdk_window_set_update_split_policy (gdouble    min_coverage,
+                                               gint       min_area,
+                                               gint       max_passes);
+void       gdk_window_get_update_split_policy (gdouble   *min_coverage,
+                                               gint      *min_area,
+                                               gint      *max_passes);
+
 void       gdk_window_constrain_size      (GdkGeometry  *geometry,
                                            guint         flags,
                                            gint          width,
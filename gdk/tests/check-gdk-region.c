@@ -0,0 +1,247 @@
+/* This file is part of GTK+
+ *
+ * This work is provided "as is"; redistribution and modification
+ * in whole or in part, in any medium, physical or electronic is
+ * permitted without restriction.
+ *
+ * This work is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <gdk/gdk.h>
+
+static GdkRectangle *
+random_rectangles (GRand *rand,
+		   gint   n_rectangles)
+{
+  GdkRectangle *rectangles;
+  gint i;
+
+  rectangles = g_new (GdkRectangle, n_rectangles);
+
+  for (i = 0; i < n_rectangles; i++)
+    {
+      rectangles[i].x = g_rand_int_range (rand, -10, 100);
+      rectangles[i].y = g_rand_int_range (rand, -10, 100);
+      rectangles[i].width = g_rand_int_range (rand, -2, 30);
+      rectangles[i].height = g_rand_int_range (rand, -2, 30);
+    }
+
+  return rectangles;
+}
+
+/* One rectangle per row, as when invalidating many rows of a list */
+static GdkRectangle *
+row_rectangles (gint n_rectangles)
+{
+  GdkRectangle *rectangles;
+  gint i;
+
+  rectangles = g_new (GdkRectangle, n_rectangles);
+
+  for (i = 0; i < n_rectangles; i++)
+    {
+      rectangles[i].x = (i % 3) * 10;
+      rectangles[i].y = i * 20;
+      rectangles[i].width = 400 - (i % 3) * 10;
+      rectangles[i].height = 18;
+    }
+
+  return rectangles;
+}
+
+static GdkRegion *
+union_rectangles (const GdkRectangle *rectangles,
+		  gint                n_rectangles)
+{
+  GdkRegion *region;
+  gint i;
+
+  region = gdk_region_new ();
+  for (i = 0; i < n_rectangles; i++)
+    gdk_region_union_with_rect (region, &rectangles[i]);
+
+  return region;
+}
+
+static void
+test_region_rectangles (void)
+{
+  GRand *rand;
+  gint i;
+
+  rand = g_rand_new_with_seed (42);
+
+  for (i = 0; i < 500; i++)
+    {
+      GdkRectangle *rectangles;
+      GdkRegion *expected, *region;
+      GdkRectangle *a, *b;
+      gint n_rectangles, n_a, n_b, j;
+
+      n_rectangles = g_rand_int_range (rand, 0, 50);
+      rectangles = random_rectangles (rand, n_rectangles);
+
+      expected = union_rectangles (rectangles, n_rectangles);
+      region = gdk_region_rectangles (rectangles, n_rectangles);
+
+      g_assert (gdk_region_equal (region, expected));
+
+      /* Both must be in the same canonical banded form */
+      gdk_region_get_rectangles (expected, &a, &n_a);
+      gdk_region_get_rectangles (region, &b, &n_b);
+      g_assert_cmpint (n_a, ==, n_b);
+      for (j = 0; j < n_a; j++)
+	g_assert (a[j].x == b[j].x && a[j].y == b[j].y &&
+		  a[j].width == b[j].width && a[j].height == b[j].height);
+
+      g_free (a);
+      g_free (b);
+      gdk_region_destroy (region);
+      gdk_region_destroy (expected);
+      g_free (rectangles);
+    }
+
+  g_rand_free (rand);
+}
+
+static void
+test_region_rect_in (void)
+{
+  GdkRectangle *rectangles;
+  GdkRectangle rect;
+  GdkRegion *region;
+
+  rectangles = row_rectangles (1000);
+  region = gdk_region_rectangles (rectangles, 1000);
+
+  rect.x = 50;
+  rect.y = 19000;
+  rect.width = 100;
+  rect.height = 10;
+  g_assert_cmpint (gdk_region_rect_in (region, &rect), ==, GDK_OVERLAP_RECTANGLE_IN);
+
+  rect.y = 19015;
+  g_assert_cmpint (gdk_region_rect_in (region, &rect), ==, GDK_OVERLAP_RECTANGLE_PART);
+
+  rect.y = 19018;
+  rect.height = 2;
+  g_assert_cmpint (gdk_region_rect_in (region, &rect), ==, GDK_OVERLAP_RECTANGLE_OUT);
+
+  g_assert (gdk_region_point_in (region, 25, 19000));
+  g_assert (!gdk_region_point_in (region, 5, 19040));
+  g_assert (!gdk_region_point_in (region, 25, 19019));
+
+  gdk_region_destroy (region);
+  g_free (rectangles);
+}
+
+static void
+test_region_offset (void)
+{
+  static const gint offsets[][2] = {
+    { 7, 0 }, { 0, -13 }, { -5, 9 }
+  };
+  GRand *rand;
+  gint i, j, k;
+
+  rand = g_rand_new_with_seed (42);
+
+  for (i = 0; i < 100; i++)
+    {
+      GdkRectangle *rectangles;
+      gint n_rectangles = g_rand_int_range (rand, 0, 20);
+
+      rectangles = random_rectangles (rand, n_rectangles);
+
+      for (j = 0; j < G_N_ELEMENTS (offsets); j++)
+	{
+	  GdkRegion *region, *expected;
+	  GdkRectangle a, b;
+
+	  region = union_rectangles (rectangles, n_rectangles);
+	  gdk_region_offset (region, offsets[j][0], offsets[j][1]);
+
+	  for (k = 0; k < n_rectangles; k++)
+	    {
+	      rectangles[k].x += offsets[j][0];
+	      rectangles[k].y += offsets[j][1];
+	    }
+	  expected = union_rectangles (rectangles, n_rectangles);
+	  for (k = 0; k < n_rectangles; k++)
+	    {
+	      rectangles[k].x -= offsets[j][0];
+	      rectangles[k].y -= offsets[j][1];
+	    }
+
+	  g_assert (gdk_region_equal (region, expected));
+
+	  gdk_region_get_clipbox (region, &a);
+	  gdk_region_get_clipbox (expected, &b);
+	  if (!gdk_region_empty (expected))
+	    {
+	      g_assert_cmpint (a.x, ==, b.x);
+	      g_assert_cmpint (a.y, ==, b.y);
+	      g_assert_cmpint (a.width, ==, b.width);
+	      g_assert_cmpint (a.height, ==, b.height);
+	    }
+
+	  gdk_region_destroy (region);
+	  gdk_region_destroy (expected);
+	}
+
+      g_free (rectangles);
+    }
+
+  g_rand_free (rand);
+}
+
+static void
+test_region_rectangles_perf (void)
+{
+  GdkRectangle *rectangles;
+  GdkRegion *region, *expected;
+  gdouble elapsed_union, elapsed_bulk;
+  gint n_rectangles = 20000;
+
+  rectangles = row_rectangles (n_rectangles);
+
+  g_test_timer_start ();
+  expected = union_rectangles (rectangles, n_rectangles);
+  elapsed_union = g_test_timer_elapsed ();
+
+  g_test_timer_start ();
+  region = gdk_region_rectangles (rectangles, n_rectangles);
+  elapsed_bulk = g_test_timer_elapsed ();
+
+  g_assert (gdk_region_equal (region, expected));
+
+  g_test_minimized_result (elapsed_union,
+			   "%d rectangles with gdk_region_union_with_rect: %g sec",
+			   n_rectangles, elapsed_union);
+  g_test_minimized_result (elapsed_bulk,
+			   "%d rectangles with gdk_region_rectangles: %g sec",
+			   n_rectangles, elapsed_bulk);
+
+  gdk_region_destroy (region);
+  gdk_region_destroy (expected);
+  g_free (rectangles);
+}
+
+int
+main (int   argc,
+      char**argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/gdk/region/rectangles", test_region_rectangles);
+  g_test_add_func ("/gdk/region/rect-in", test_region_rect_in);
+  g_test_add_func ("/gdk/region/offset", test_region_offset);
+
+  if (g_test_perf ())
+    g_test_add_func ("/gdk/region/rectangles-performance",
+		     test_region_rectangles_perf);
+
+  return g_test_run ();
+}
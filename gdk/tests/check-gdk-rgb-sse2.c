@@ -0,0 +1,329 @@
+/* Copyright (C) 2009 Red Hat, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/* Checks that the SSE2 GdkRgb converters produce exactly the same
+ * pixels as the scalar converters in gdkrgb.c, whose per-pixel code is
+ * repeated below. The dithering converters are checked with the dither
+ * matrix that gdkrgb.c uses.
+ */
+
+#include "config.h"
+#include <string.h>
+#include <glib.h>
+
+#include "gdk/gdkrgb-sse2.h"
+#include "gdk/gdkrgb-dither.h"
+
+#define MAX_WIDTH 67
+#define MAX_HEIGHT 3
+#define SRC_ROWSTRIDE (MAX_WIDTH * 3 + 5)
+#define DST_BPL (MAX_WIDTH * 4 + 8)
+
+typedef void (*ConvertFunc) (guchar *obuf, gint bpl,
+                             const guchar *buf, gint rowstride,
+                             gint width, gint height);
+
+static void
+ref_565 (guchar *obuf, gint bpl, const guchar *buf, gint rowstride,
+         gint width, gint height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    {
+      const guchar *bp2 = buf + y * rowstride;
+
+      for (x = 0; x < width; x++)
+        {
+          guchar r = *bp2++;
+          guchar g = *bp2++;
+          guchar b = *bp2++;
+          ((guint16 *)(obuf + y * bpl))[x] = ((r & 0xf8) << 8) |
+            ((g & 0xfc) << 3) |
+            (b >> 3);
+        }
+    }
+}
+
+static void
+ref_565_d (guchar *obuf, gint bpl, const guchar *buf, gint rowstride,
+           gint width, gint height, gint x_align, gint y_align)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    {
+      const guint32 *dmp = DM_565 + (((y + y_align) & (DM_HEIGHT - 1)) << DM_WIDTH_SHIFT);
+      const guchar *bp2 = buf + y * rowstride;
+
+      for (x = 0; x < width; x++)
+        {
+          gint32 rgb = *bp2++ << 20;
+          rgb += *bp2++ << 10;
+          rgb += *bp2++;
+          rgb += dmp[(x + x_align) & (DM_WIDTH - 1)];
+          rgb += 0x10040100
+            - ((rgb & 0x1e0001e0) >> 5)
+            - ((rgb & 0x00070000) >> 6);
+
+          ((guint16 *)(obuf + y * bpl))[x] =
+            ((rgb & 0x0f800000) >> 12) |
+            ((rgb & 0x0003f000) >> 7) |
+            ((rgb & 0x000000f8) >> 3);
+        }
+    }
+}
+
+static void
+ref_888_lsb (guchar *obuf, gint bpl, const guchar *buf, gint rowstride,
+             gint width, gint height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      {
+        const guchar *p = buf + y * rowstride + x * 3;
+
+        obuf[y * bpl + x * 3] = p[2];
+        obuf[y * bpl + x * 3 + 1] = p[1];
+        obuf[y * bpl + x * 3 + 2] = p[0];
+      }
+}
+
+static void
+ref_0888 (guchar *obuf, gint bpl, const guchar *buf, gint rowstride,
+          gint width, gint height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      {
+        const guchar *p = buf + y * rowstride + x * 3;
+        guchar *o = obuf + y * bpl + x * 4;
+
+        o[0] = p[2];
+        o[1] = p[1];
+        o[2] = p[0];
+        o[3] = 0xff;
+      }
+}
+
+static void
+ref_0888_br (guchar *obuf, gint bpl, const guchar *buf, gint rowstride,
+             gint width, gint height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      {
+        const guchar *p = buf + y * rowstride + x * 3;
+        guchar *o = obuf + y * bpl + x * 4;
+
+        o[0] = 0xff;
+        o[1] = p[0];
+        o[2] = p[1];
+        o[3] = p[2];
+      }
+}
+
+static void
+ref_8880_br (guchar *obuf, gint bpl, const guchar *buf, gint rowstride,
+             gint width, gint height)
+{
+  gint x, y;
+
+  for (y = 0; y < height; y++)
+    for (x = 0; x < width; x++)
+      {
+        const guchar *p = buf + y * rowstride + x * 3;
+
+        ((guint32 *)(obuf + y * bpl))[x] = (p[2] << 16) | (p[1] << 8) | p[0];
+      }
+}
+
+static void
+fill_random (guchar *buf,
+             gsize   len)
+{
+  gsize i;
+
+  for (i = 0; i < len; i++)
+    buf[i] = g_test_rand_int_range (0, 256);
+}
+
+/* Runs both converters over every width up to MAX_WIDTH, from a source
+ * at every byte alignment and into a destination that is not 16-byte
+ * aligned, and checks that they agree and that nothing outside the area
+ * is touched.
+ */
+static void
+check_converter (ConvertFunc ref,
+                 ConvertFunc sse2)
+{
+  guchar *src = g_malloc (SRC_ROWSTRIDE * MAX_HEIGHT + 16);
+  guchar *expected = g_malloc (DST_BPL * MAX_HEIGHT + 16);
+  guchar *result = g_malloc (DST_BPL * MAX_HEIGHT + 16);
+  gint width, height, offset;
+
+  for (offset = 0; offset < 4; offset++)
+    for (height = 1; height <= MAX_HEIGHT; height++)
+      for (width = 0; width <= MAX_WIDTH; width++)
+        {
+          fill_random (src, SRC_ROWSTRIDE * MAX_HEIGHT + 16);
+          fill_random (expected, DST_BPL * MAX_HEIGHT + 16);
+          memcpy (result, expected, DST_BPL * MAX_HEIGHT + 16);
+
+          ref (expected + offset * 4, DST_BPL, src + 3 - offset, SRC_ROWSTRIDE,
+               width, height);
+          sse2 (result + offset * 4, DST_BPL, src + 3 - offset, SRC_ROWSTRIDE,
+                width, height);
+
+          g_assert (memcmp (expected, result, DST_BPL * MAX_HEIGHT + 16) == 0);
+        }
+
+  g_free (src);
+  g_free (expected);
+  g_free (result);
+}
+
+static void
+test_565 (void)
+{
+  check_converter (ref_565, _gdk_rgb_convert_565_sse2);
+}
+
+static void
+test_888_lsb (void)
+{
+  check_converter (ref_888_lsb, _gdk_rgb_convert_888_lsb_sse2);
+}
+
+static void
+test_0888 (void)
+{
+  check_converter (ref_0888, _gdk_rgb_convert_0888_sse2);
+}
+
+static void
+test_0888_br (void)
+{
+  check_converter (ref_0888_br, _gdk_rgb_convert_0888_br_sse2);
+}
+
+static void
+test_8880_br (void)
+{
+  check_converter (ref_8880_br, _gdk_rgb_convert_8880_br_sse2);
+}
+
+static void
+test_dm_565 (void)
+{
+  gint i;
+
+  /* The table is the output of gdk_rgb_preprocess_dm_565() */
+  for (i = 0; i < DM_WIDTH * DM_HEIGHT; i++)
+    {
+      guint32 dith = DM[i >> DM_WIDTH_SHIFT][i & (DM_WIDTH - 1)] >> 3;
+
+      g_assert_cmpuint (DM_565[i], ==,
+                        (dith << 20) | dith | (((7 - dith) >> 1) << 10));
+    }
+}
+
+static void
+check_565_d (const guchar *src,
+             guchar       *expected,
+             guchar       *result,
+             gint          width,
+             gint          x_align,
+             gint          y_align)
+{
+  ref_565_d (expected + 2, DST_BPL, src + 1, SRC_ROWSTRIDE,
+             width, MAX_HEIGHT, x_align, y_align);
+  _gdk_rgb_convert_565_d_sse2 (result + 2, DST_BPL, src + 1, SRC_ROWSTRIDE,
+                               width, MAX_HEIGHT, x_align, y_align,
+                               DM_565, DM_WIDTH_SHIFT, DM_HEIGHT);
+
+  g_assert (memcmp (expected, result, DST_BPL * MAX_HEIGHT) == 0);
+}
+
+static void
+test_565_d (void)
+{
+  guchar *src = g_malloc (SRC_ROWSTRIDE * MAX_HEIGHT);
+  guchar *expected = g_malloc (DST_BPL * MAX_HEIGHT);
+  guchar *result = g_malloc (DST_BPL * MAX_HEIGHT);
+  const gint y_aligns[] = { 0, 1, DM_HEIGHT / 2, DM_HEIGHT - 2, DM_HEIGHT - 1 };
+  gint width, x_align;
+  guint i;
+
+  /* Every width up to MAX_WIDTH, so that all lengths of the scalar
+   * tail after the 8 pixel blocks are covered, at every horizontal
+   * phase of the matrix including those that wrap around its right
+   * edge, and at rows that wrap around its bottom edge.
+   */
+  for (i = 0; i < G_N_ELEMENTS (y_aligns); i++)
+    for (x_align = 0; x_align < DM_WIDTH; x_align++)
+      for (width = 0; width <= MAX_WIDTH; width++)
+        {
+          fill_random (src, SRC_ROWSTRIDE * MAX_HEIGHT);
+          fill_random (expected, DST_BPL * MAX_HEIGHT);
+          memcpy (result, expected, DST_BPL * MAX_HEIGHT);
+
+          check_565_d (src, expected, result, width, x_align, y_aligns[i]);
+        }
+
+  /* Saturated input is where the clamping matters */
+  memset (src, 0xff, SRC_ROWSTRIDE * MAX_HEIGHT);
+  for (x_align = 0; x_align < DM_WIDTH; x_align++)
+    for (width = MAX_WIDTH - 7; width <= MAX_WIDTH; width++)
+      {
+        memset (expected, 0, DST_BPL * MAX_HEIGHT);
+        memset (result, 0, DST_BPL * MAX_HEIGHT);
+
+        check_565_d (src, expected, result, width, x_align, DM_HEIGHT - 1);
+      }
+
+  g_free (src);
+  g_free (expected);
+  g_free (result);
+}
+
+int
+main (int argc, char **argv)
+{
+  g_test_init (&argc, &argv, NULL);
+
+  g_test_add_func ("/gdk/rgb/dm-565", test_dm_565);
+
+  if (_gdk_rgb_have_sse2 ())
+    {
+      g_test_add_func ("/gdk/rgb/sse2/565", test_565);
+      g_test_add_func ("/gdk/rgb/sse2/565-dither", test_565_d);
+      g_test_add_func ("/gdk/rgb/sse2/888-lsb", test_888_lsb);
+      g_test_add_func ("/gdk/rgb/sse2/0888", test_0888);
+      g_test_add_func ("/gdk/rgb/sse2/0888-br", test_0888_br);
+      g_test_add_func ("/gdk/rgb/sse2/8880-br", test_8880_br);
+    }
+
+  return g_test_run ();
+}
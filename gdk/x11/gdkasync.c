@@ -48,6 +48,7 @@ in this Software without prior written authorization from The Open Group.
 #include <X11/extensions/XIproto.h>
 #endif
 #include <X11/Xlibint.h>
+#include <X11/Xatom.h>
 #include "gdkasync.h"
 #include "gdkx.h"
 #include "gdkalias.h"
@@ -57,6 +58,7 @@ typedef struct _ChildInfoState ChildInfoState;
 typedef struct _ListChildrenState ListChildrenState;
 typedef struct _SendEventState SendEventState;
 typedef struct _SetInputFocusState SetInputFocusState;
+typedef struct _WindowGeometryState WindowGeometryState;
 
 typedef enum {
   CHILD_INFO_GET_PROPERTY,
@@ -112,6 +114,13 @@ struct _SetInputFocusState
   gulong get_input_focus_req;
 };
 
+struct _WindowGeometryState
+{
+  gulong get_geometry_req;
+  gulong get_property_req;
+  GdkWindowGeometryX11 *geometry;
+};
+
 static gboolean
 callback_idle (gpointer data)
 {
@@ -743,5 +752,165 @@ _gdk_x11_get_window_child_info (GdkDisplay       *display,
   return !state.have_error;
 }
 
+static Bool
+get_window_geometry_handler (Display *dpy,
+			     xReply  *rep,
+			     char    *buf,
+			     int      len,
+			     XPointer data)
+{
+  WindowGeometryState *state = (WindowGeometryState *)data;
+
+  if (dpy->last_request_read == state->get_geometry_req)
+    {
+      xGetGeometryReply replbuf;
+      xGetGeometryReply *repl;
+
+      if (rep->generic.type == X_Error)
+	return False;
+
+      repl = (xGetGeometryReply *)
+	_XGetAsyncReply(dpy, (char *)&replbuf, rep, buf, len,
+			(sizeof(xGetGeometryReply) - sizeof(xReply)) >> 2,
+			True);
+
+      state->geometry->width = repl->width;
+      state->geometry->height = repl->height;
+      state->geometry->has_geometry = TRUE;
+
+      return True;
+    }
+  else if (dpy->last_request_read == state->get_property_req)
+    {
+      xGetPropertyReply replbuf;
+      xGetPropertyReply *repl;
+
+      if (rep->generic.type == X_Error)
+	return False;
+
+      repl = (xGetPropertyReply *)
+	_XGetAsyncReply(dpy, (char *)&replbuf, rep, buf, len,
+			(sizeof(xGetPropertyReply) - sizeof(xReply)) >> 2,
+			False);
+
+      if (repl->propertyType == XA_CARDINAL && repl->format == 32 &&
+	  repl->nItems == 4 && repl->bytesAfter == 0)
+	{
+	  CARD32 extents[4];
+	  gint i;
+
+	  _XGetAsyncData (dpy, (char *)extents, buf, len,
+			  sizeof(xGetPropertyReply), sizeof(extents),
+			  repl->length << 2);
+
+	  for (i = 0; i < 4; i++)
+	    state->geometry->frame_extents[i] = extents[i];
+	  state->geometry->has_frame_extents = TRUE;
+	}
+      else
+	{
+	  /* Consume whatever property data follows the reply
+	   */
+	  _XGetAsyncData (dpy, NULL, buf, len,
+			  sizeof(xGetPropertyReply), 0,
+			  repl->length << 2);
+	}
+
+      return True;
+    }
+
+  return False;
+}
+
+/* Fetches the size of @window, its origin in @root coordinates
+ * and, if @frame_extents_atom is not None, the window manager frame
+ * extents stored in that property; all with a single round trip
+ * instead of one for each of XGetGeometry, XGetWindowProperty and
+ * XTranslateCoordinates. The fields of @geometry that could not be
+ * retrieved are flagged through has_geometry and has_frame_extents.
+ */
+gboolean
+_gdk_x11_get_window_geometry (GdkDisplay           *display,
+			      Window                window,
+			      Window                root,
+			      Atom                  frame_extents_atom,
+			      GdkWindowGeometryX11 *geometry)
+{
+  Display *dpy;
+  _XAsyncHandler async;
+  WindowGeometryState state;
+  xTranslateCoordsReply rep;
+  gboolean result;
+
+  dpy = GDK_DISPLAY_XDISPLAY (display);
+
+  geometry->root_x = 0;
+  geometry->root_y = 0;
+  geometry->width = 1;
+  geometry->height = 1;
+  geometry->has_geometry = FALSE;
+  geometry->has_frame_extents = FALSE;
+
+  state.geometry = geometry;
+  state.get_property_req = 0;
+
+  LockDisplay(dpy);
+
+  async.next = dpy->async_handlers;
+  async.handler = get_window_geometry_handler;
+  async.data = (XPointer) &state;
+  dpy->async_handlers = &async;
+
+  if (frame_extents_atom != None)
+    {
+      xGetPropertyReq *prop_req;
+
+      GetReq (GetProperty, prop_req);
+      prop_req->window = window;
+      prop_req->property = frame_extents_atom;
+      prop_req->type = XA_CARDINAL;
+      prop_req->delete = False;
+      prop_req->longOffset = 0;
+      prop_req->longLength = 4;
+
+      state.get_property_req = dpy->request;
+    }
+
+  {
+    xResourceReq *resource_req;
+
+    GetResReq(GetGeometry, window, resource_req);
+    state.get_geometry_req = dpy->request;
+  }
+
+  {
+    xTranslateCoordsReq *req;
+
+    GetReq(TranslateCoords, req);
+    req->srcWid = window;
+    req->dstWid = root;
+    req->srcX = 0;
+    req->srcY = 0;
+  }
+
+  /* Wait for the last reply; the others are picked up by our
+   * async handler on the way.
+   */
+  result = _XReply (dpy, (xReply *)&rep, 0, xTrue);
+  if (result)
+    {
+      geometry->root_x = cvtINT16toInt (rep.dstX);
+      geometry->root_y = cvtINT16toInt (rep.dstY);
+    }
+  else
+    geometry->has_geometry = FALSE;
+
+  DeqAsyncHandler(dpy, &async);
+  UnlockDisplay(dpy);
+  SyncHandle();
+
+  return result && geometry->has_geometry;
+}
+
 #define __GDK_ASYNC_C__
 #include "gdkaliasdef.c"
@@ -27,6 +27,7 @@
 G_BEGIN_DECLS
 
 typedef struct _GdkChildInfoX11 GdkChildInfoX11;
+typedef struct _GdkWindowGeometryX11 GdkWindowGeometryX11;
 
 typedef void (*GdkSendXEventCallback) (Window   window,
 				       gboolean success,
@@ -44,6 +45,17 @@ struct _GdkChildInfoX11
   guint window_class : 2;
 };
 
+struct _GdkWindowGeometryX11
+{
+  gint root_x;
+  gint root_y;
+  gint width;
+  gint height;
+  gulong frame_extents[4];	/* left, right, top, bottom */
+  guint has_geometry : 1;
+  guint has_frame_extents : 1;
+};
+
 void _gdk_x11_send_client_message_async (GdkDisplay            *display,
 					 Window                 window,
 					 gboolean               propagate,
@@ -63,6 +75,12 @@ gboolean _gdk_x11_get_window_child_info (GdkDisplay       *display,
 					 GdkChildInfoX11 **children,
 					 guint            *nchildren);
 
+gboolean _gdk_x11_get_window_geometry   (GdkDisplay           *display,
+					 Window                window,
+					 Window                root,
+					 Atom                  frame_extents_atom,
+					 GdkWindowGeometryX11 *geometry);
+
 G_END_DECLS
 
 #endif /* __GDK_ASYNC_H__ */
@@ -122,6 +122,7 @@ struct _GdkDisplayX11
 
   GHashTable *atom_from_virtual;
   GHashTable *atom_to_virtual;
+  guint atom_round_trips;
 
   /* Session Management leader window see ICCCM */
   Window leader_window;
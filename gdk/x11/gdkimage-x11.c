@@ -613,9 +613,25 @@ _gdk_x11_copy_to_image (GdkDrawable    *drawable,
 
       private = PRIVATE_DATA (image);
 
-      /* In the ShmImage but no ShmPixmap case, we could use XShmGetImage when
-       * we are getting the entire image.
+      /* In the ShmImage but no ShmPixmap case, use XShmGetImage when
+       * we are getting the entire image; it transfers the pixels
+       * through the shared segment instead of the protocol stream.
        */
+#ifdef USE_SHM
+      if (image->type == GDK_IMAGE_SHARED &&
+	  dest_x == 0 && dest_y == 0 &&
+	  req.x == src_x && req.y == src_y &&
+	  req.width == image->width && req.height == image->height)
+	{
+	  if (!XShmGetImage (xdisplay, impl->xid, private->ximage,
+			     req.x, req.y, AllPlanes))
+	    {
+	      image = NULL;
+	      success = FALSE;
+	    }
+	}
+      else
+#endif /* USE_SHM */
       if (XGetSubImage (xdisplay, impl->xid,
 			req.x, req.y, req.width, req.height,
 			AllPlanes, ZPixmap,
@@ -205,16 +205,21 @@ gdk_x11_atom_to_xatom_for_display (GdkDisplay *display,
       name = g_ptr_array_index (virtual_atom_array, ATOM_TO_INDEX (atom));
       
       xatom = XInternAtom (GDK_DISPLAY_XDISPLAY (display), name, FALSE);
+      GDK_DISPLAY_X11 (display)->atom_round_trips++;
       insert_atom_pair (display, atom, xatom);
     }
 
   return xatom;
 }
 
-void
-_gdk_x11_precache_atoms (GdkDisplay          *display,
-			 const gchar * const *atom_names,
-			 gint                 n_atoms)
+/* With @static_names, the names are kept by the atom table without
+ * being copied, so they must stay around for the life of the process.
+ */
+static void
+precache_atoms (GdkDisplay          *display,
+		const gchar * const *atom_names,
+		gint                 n_atoms,
+		gboolean             static_names)
 {
   Atom *xatoms;
   GdkAtom *atoms;
@@ -229,7 +234,13 @@ _gdk_x11_precache_atoms (GdkDisplay          *display,
   n_xatoms = 0;
   for (i = 0; i < n_atoms; i++)
     {
-      GdkAtom atom = gdk_atom_intern_static_string (atom_names[i]);
+      GdkAtom atom;
+
+      if (static_names)
+	atom = gdk_atom_intern_static_string (atom_names[i]);
+      else
+	atom = gdk_atom_intern (atom_names[i], FALSE);
+
       if (lookup_cached_xatom (display, atom) == None)
 	{
 	  atoms[n_xatoms] = atom;
@@ -243,10 +254,12 @@ _gdk_x11_precache_atoms (GdkDisplay          *display,
 #ifdef HAVE_XINTERNATOMS
       XInternAtoms (GDK_DISPLAY_XDISPLAY (display),
 		    (char **)xatom_names, n_xatoms, False, xatoms);
+      GDK_DISPLAY_X11 (display)->atom_round_trips++;
 #else
       for (i = 0; i < n_xatoms; i++)
 	xatoms[i] = XInternAtom (GDK_DISPLAY_XDISPLAY (display),
 				 xatom_names[i], False);
+      GDK_DISPLAY_X11 (display)->atom_round_trips += n_xatoms;
 #endif
     }
 
@@ -258,6 +271,67 @@ _gdk_x11_precache_atoms (GdkDisplay          *display,
   g_free (atoms);
 }
 
+void
+_gdk_x11_precache_atoms (GdkDisplay          *display,
+			 const gchar * const *atom_names,
+			 gint                 n_atoms)
+{
+  precache_atoms (display, atom_names, n_atoms, TRUE);
+}
+
+/**
+ * gdk_x11_display_precache_atoms:
+ * @display: a #GdkDisplay
+ * @atom_names: an array of atom names
+ * @n_atoms: the number of elements in @atom_names
+ *
+ * Resolves the X atoms for all names in @atom_names that are not
+ * known yet for @display, using a single request to the X server.
+ * Later calls to gdk_x11_atom_to_xatom_for_display() or
+ * gdk_x11_get_xatom_by_name_for_display() for these atoms are then
+ * answered from the cache without a round trip.
+ *
+ * This is useful for code that knows the set of atoms it is going
+ * to use in advance, for example right after opening a display.
+ * The names are copied, so @atom_names can be freed afterwards.
+ *
+ * Since: 2.18
+ **/
+void
+gdk_x11_display_precache_atoms (GdkDisplay          *display,
+				const gchar * const *atom_names,
+				gint                 n_atoms)
+{
+  g_return_if_fail (GDK_IS_DISPLAY (display));
+  g_return_if_fail (atom_names != NULL || n_atoms == 0);
+
+  if (display->closed)
+    return;
+
+  precache_atoms (display, atom_names, n_atoms, FALSE);
+}
+
+/**
+ * gdk_x11_display_get_atom_round_trips:
+ * @display: a #GdkDisplay
+ *
+ * Returns the number of requests GDK has made to the X server of
+ * @display for interning or looking up atoms. A bulk request made
+ * by gdk_x11_display_precache_atoms() counts as one. This is mostly
+ * useful for measuring startup latency on remote displays.
+ *
+ * Return value: the number of atom round trips made so far
+ *
+ * Since: 2.18
+ **/
+guint
+gdk_x11_display_get_atom_round_trips (GdkDisplay *display)
+{
+  g_return_val_if_fail (GDK_IS_DISPLAY (display), 0);
+
+  return GDK_DISPLAY_X11 (display)->atom_round_trips;
+}
+
 /**
  * gdk_x11_atom_to_xatom:
  * @atom: A #GdkAtom 
@@ -315,6 +389,7 @@ gdk_x11_xatom_to_atom_for_display (GdkDisplay *display,
       char *name;
       gdk_error_trap_push ();
       name = XGetAtomName (GDK_DISPLAY_XDISPLAY (display), xatom);
+      display_x11->atom_round_trips++;
       if (gdk_error_trap_pop ())
 	{
 	  g_warning (G_STRLOC " invalid X atom: %ld", xatom);
@@ -3123,10 +3123,10 @@ gdk_window_get_frame_extents (GdkWindow    *window,
   Window xwindow;
   Window xparent;
   Window root;
-  Window child;
   Window *children;
   guchar *data;
   Window *vroots;
+  GdkWindowGeometryX11 geometry;
   Atom type_return;
   guint nchildren;
   guint nvroots;
@@ -3170,42 +3170,31 @@ gdk_window_get_frame_extents (GdkWindow    *window,
   display = gdk_drawable_get_display (window);
   xwindow = GDK_WINDOW_XID (window);
 
-  /* first try: use _NET_FRAME_EXTENTS */
-  if (XGetWindowProperty (GDK_DISPLAY_XDISPLAY (display), xwindow,
-			  gdk_x11_get_xatom_by_name_for_display (display,
-								 "_NET_FRAME_EXTENTS"),
-			  0, G_MAXLONG, False, XA_CARDINAL, &type_return,
-			  &format_return, &nitems_return, &bytes_after_return,
-			  &data)
-      == Success)
+  /* first try: use _NET_FRAME_EXTENTS, fetched together with the
+   * real client window geometry in a single round trip
+   */
+  _gdk_x11_get_window_geometry (display, xwindow, GDK_WINDOW_XROOTWIN (window),
+				gdk_x11_get_xatom_by_name_for_display (display,
+								       "_NET_FRAME_EXTENTS"),
+				&geometry);
+
+  if (geometry.has_frame_extents)
     {
-      if ((type_return == XA_CARDINAL) && (format_return == 32) &&
-	  (nitems_return == 4) && (data))
-        {
-	  gulong *ldata = (gulong *) data;
-	  got_frame_extents = TRUE;
-
-	  /* try to get the real client window geometry */
-	  if (XGetGeometry (GDK_DISPLAY_XDISPLAY (display), xwindow,
-			    &root, &wx, &wy, &ww, &wh, &wb, &wd) &&
-              XTranslateCoordinates (GDK_DISPLAY_XDISPLAY (display),
-	  			     xwindow, root, 0, 0, &wx, &wy, &child))
-            {
-	      rect->x = wx;
-	      rect->y = wy;
-	      rect->width = ww;
-	      rect->height = wh;
-	    }
+      got_frame_extents = TRUE;
 
-	  /* _NET_FRAME_EXTENTS format is left, right, top, bottom */
-	  rect->x -= ldata[0];
-	  rect->y -= ldata[2];
-	  rect->width += ldata[0] + ldata[1];
-	  rect->height += ldata[2] + ldata[3];
+      if (geometry.has_geometry)
+	{
+	  rect->x = geometry.root_x;
+	  rect->y = geometry.root_y;
+	  rect->width = geometry.width;
+	  rect->height = geometry.height;
 	}
 
-      if (data)
-	XFree (data);
+      /* _NET_FRAME_EXTENTS format is left, right, top, bottom */
+      rect->x -= geometry.frame_extents[0];
+      rect->y -= geometry.frame_extents[2];
+      rect->width += geometry.frame_extents[0] + geometry.frame_extents[1];
+      rect->height += geometry.frame_extents[2] + geometry.frame_extents[3];
     }
 
   if (got_frame_extents)
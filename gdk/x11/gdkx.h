@@ -184,6 +184,11 @@ Atom                  gdk_x11_get_xatom_by_name (const gchar *atom_name);
 G_CONST_RETURN gchar *gdk_x11_get_xatom_name    (Atom         xatom);
 #endif
 
+void        gdk_x11_display_precache_atoms       (GdkDisplay          *display,
+						  const gchar * const *atom_names,
+						  gint                 n_atoms);
+guint       gdk_x11_display_get_atom_round_trips (GdkDisplay          *display);
+
 void	    gdk_x11_display_grab	      (GdkDisplay *display);
 void	    gdk_x11_display_ungrab	      (GdkDisplay *display);
 void        gdk_x11_register_standard_event_type (GdkDisplay *display,
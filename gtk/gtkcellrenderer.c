@@ -787,5 +787,52 @@ gtk_cell_renderer_stop_editing (GtkCellRenderer *cell,
     }
 }
 
+static GQuark quark_attribute_setters = 0;
+
+void
+_gtk_cell_renderer_class_install_attribute_setter (GtkCellRendererClass           *cell_class,
+						   const gchar                    *property,
+						   GtkCellRendererAttributeSetter  setter)
+{
+  GType type = G_TYPE_FROM_CLASS (cell_class);
+  GHashTable *setters;
+
+  if (!quark_attribute_setters)
+    quark_attribute_setters = g_quark_from_static_string ("gtk-cell-renderer-attribute-setters");
+
+  setters = g_type_get_qdata (type, quark_attribute_setters);
+  if (setters == NULL)
+    {
+      setters = g_hash_table_new (g_str_hash, g_str_equal);
+      g_type_set_qdata (type, quark_attribute_setters, setters);
+    }
+
+  g_hash_table_insert (setters, (gpointer) g_intern_string (property), (gpointer) setter);
+}
+
+GtkCellRendererAttributeSetter
+_gtk_cell_renderer_get_attribute_setter (GtkCellRenderer *cell,
+					 GParamSpec      *pspec)
+{
+  GObjectClass *owner_class;
+  GHashTable *setters;
+
+  if (!quark_attribute_setters)
+    return NULL;
+
+  setters = g_type_get_qdata (pspec->owner_type, quark_attribute_setters);
+  if (setters == NULL)
+    return NULL;
+
+  /* A subclass overriding set_property() may handle the property
+   * itself, so only trust the setter if it doesn't.
+   */
+  owner_class = g_type_class_peek (pspec->owner_type);
+  if (G_OBJECT_GET_CLASS (cell)->set_property != owner_class->set_property)
+    return NULL;
+
+  return (GtkCellRendererAttributeSetter) g_hash_table_lookup (setters, pspec->name);
+}
+
 #define __GTK_CELL_RENDERER_C__
 #include "gtkaliasdef.c"
@@ -24,6 +24,7 @@
 #include "gtkicontheme.h"
 #include "gtkintl.h"
 #include "gtkprivate.h"
+#include "gtktreeprivate.h"
 #include "gtkalias.h"
 
 static void gtk_cell_renderer_pixbuf_get_property  (GObject                    *object,
@@ -51,6 +52,8 @@ static void gtk_cell_renderer_pixbuf_render     (GtkCellRenderer            *cel
 						 GdkRectangle               *cell_area,
 						 GdkRectangle               *expose_area,
 						 GtkCellRendererState        flags);
+static void gtk_cell_renderer_pixbuf_set_pixbuf_attribute (GtkCellRenderer *cell,
+							   gconstpointer    data);
 
 
 enum {
@@ -105,6 +108,9 @@ gtk_cell_renderer_pixbuf_class_init (GtkCellRendererPixbufClass *class)
   cell_class->get_size = gtk_cell_renderer_pixbuf_get_size;
   cell_class->render = gtk_cell_renderer_pixbuf_render;
 
+  _gtk_cell_renderer_class_install_attribute_setter (cell_class, "pixbuf",
+						     gtk_cell_renderer_pixbuf_set_pixbuf_attribute);
+
   g_object_class_install_property (object_class,
 				   PROP_PIXBUF,
 				   g_param_spec_object ("pixbuf",
@@ -284,7 +290,8 @@ gtk_cell_renderer_pixbuf_get_property (GObject        *object,
 }
 
 static void
-unset_image_properties (GtkCellRendererPixbuf *cell)
+unset_image_properties (GtkCellRendererPixbuf *cell,
+			gboolean               notify)
 {
   GtkCellRendererPixbufPrivate *priv;
 
@@ -294,25 +301,29 @@ unset_image_properties (GtkCellRendererPixbuf *cell)
     {
       g_free (priv->stock_id);
       priv->stock_id = NULL;
-      g_object_notify (G_OBJECT (cell), "stock-id");
+      if (notify)
+	g_object_notify (G_OBJECT (cell), "stock-id");
     }
   if (priv->icon_name)
     {
       g_free (priv->icon_name);
       priv->icon_name = NULL;
-      g_object_notify (G_OBJECT (cell), "icon-name");
+      if (notify)
+	g_object_notify (G_OBJECT (cell), "icon-name");
     }
   if (cell->pixbuf)
     {
       g_object_unref (cell->pixbuf);
       cell->pixbuf = NULL;
-      g_object_notify (G_OBJECT (cell), "pixbuf");
+      if (notify)
+	g_object_notify (G_OBJECT (cell), "pixbuf");
     }
   if (priv->gicon)
     {
       g_object_unref (priv->gicon);
       priv->gicon = NULL;
-      g_object_notify (G_OBJECT (cell), "gicon");
+      if (notify)
+	g_object_notify (G_OBJECT (cell), "gicon");
     }
 }
 
@@ -330,7 +341,7 @@ gtk_cell_renderer_pixbuf_set_property (GObject      *object,
   switch (param_id)
     {
     case PROP_PIXBUF:
-      unset_image_properties (cellpixbuf);
+      unset_image_properties (cellpixbuf, TRUE);
       cellpixbuf->pixbuf = (GdkPixbuf *) g_value_dup_object (value);
       break;
     case PROP_PIXBUF_EXPANDER_OPEN:
@@ -344,7 +355,7 @@ gtk_cell_renderer_pixbuf_set_property (GObject      *object,
       cellpixbuf->pixbuf_expander_closed = (GdkPixbuf*) g_value_dup_object (value);
       break;
     case PROP_STOCK_ID:
-      unset_image_properties (cellpixbuf);
+      unset_image_properties (cellpixbuf, TRUE);
       priv->stock_id = g_value_dup_string (value);
       break;
     case PROP_STOCK_SIZE:
@@ -355,14 +366,14 @@ gtk_cell_renderer_pixbuf_set_property (GObject      *object,
       priv->stock_detail = g_value_dup_string (value);
       break;
     case PROP_ICON_NAME:
-      unset_image_properties (cellpixbuf);
+      unset_image_properties (cellpixbuf, TRUE);
       priv->icon_name = g_value_dup_string (value);
       break;
     case PROP_FOLLOW_STATE:
       priv->follow_state = g_value_get_boolean (value);
       break;
     case PROP_GICON:
-      unset_image_properties (cellpixbuf);
+      unset_image_properties (cellpixbuf, TRUE);
       priv->gicon = (GIcon *) g_value_dup_object (value);
       break;
     default:
@@ -371,6 +382,18 @@ gtk_cell_renderer_pixbuf_set_property (GObject      *object,
     }
 }
 
+static void
+gtk_cell_renderer_pixbuf_set_pixbuf_attribute (GtkCellRenderer *cell,
+					       gconstpointer    data)
+{
+  GtkCellRendererPixbuf *cellpixbuf = (GtkCellRendererPixbuf *) cell;
+
+  if (data)
+    g_object_ref ((GdkPixbuf *) data);
+  unset_image_properties (cellpixbuf, FALSE);
+  cellpixbuf->pixbuf = (GdkPixbuf *) data;
+}
+
 /**
  * gtk_cell_renderer_pixbuf_new:
  * 
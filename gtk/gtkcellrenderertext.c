@@ -19,6 +19,7 @@
 
 #include "config.h"
 #include <stdlib.h>
+#include <string.h>
 #include "gtkcellrenderertext.h"
 #include "gtkeditable.h"
 #include "gtkentry.h"
@@ -61,6 +62,11 @@ static GtkCellEditable *gtk_cell_renderer_text_start_editing (GtkCellRenderer
 							      GdkRectangle         *cell_area,
 							      GtkCellRendererState  flags);
 
+static void gtk_cell_renderer_text_set_text           (GtkCellRendererText *celltext,
+						       const gchar         *text);
+static void gtk_cell_renderer_text_set_text_attribute (GtkCellRenderer     *cell,
+						       gconstpointer        data);
+
 enum {
   EDITED,
   LAST_SIGNAL
@@ -76,6 +82,7 @@ enum {
   PROP_WIDTH_CHARS,
   PROP_WRAP_WIDTH,
   PROP_ALIGN,
+  PROP_CACHE_LAYOUTS,
   
   /* Style args */
   PROP_BACKGROUND,
@@ -133,6 +140,7 @@ struct _GtkCellRendererTextPrivate
   guint markup_set : 1;
   guint ellipsize_set : 1;
   guint align_set : 1;
+  guint cache_layouts : 1;
   
   gulong focus_out_id;
   PangoLanguage *language;
@@ -189,6 +197,9 @@ gtk_cell_renderer_text_class_init (GtkCellRendererTextClass *class)
   cell_class->render = gtk_cell_renderer_text_render;
   cell_class->start_editing = gtk_cell_renderer_text_start_editing;
 
+  _gtk_cell_renderer_class_install_attribute_setter (cell_class, "text",
+						     gtk_cell_renderer_text_set_text_attribute);
+
   g_object_class_install_property (object_class,
                                    PROP_TEXT,
                                    g_param_spec_string ("text",
@@ -493,6 +504,26 @@ gtk_cell_renderer_text_class_init (GtkCellRendererTextClass *class)
 						      PANGO_TYPE_ALIGNMENT,
 						      PANGO_ALIGN_LEFT,
 						      GTK_PARAM_READWRITE));
+
+  /**
+   * GtkCellRendererText:cache-layouts:
+   *
+   * Whether to keep the layouts of rendered text around for reuse.
+   * The layouts are shared by all text renderers drawing on the same
+   * widget that have this property set, so a row that is measured
+   * several times and then drawn is only shaped once. This helps
+   * large tree views with expensive text, at the cost of keeping up
+   * to a few hundred layouts per widget in memory.
+   *
+   * Since: 2.18
+   */
+  g_object_class_install_property (object_class,
+                                   PROP_CACHE_LAYOUTS,
+                                   g_param_spec_boolean ("cache-layouts",
+							 P_("Cache layouts"),
+							 P_("Whether to keep rendered text layouts for reuse"),
+							 FALSE,
+							 GTK_PARAM_READWRITE));
   
   /* Style props are set or not */
 
@@ -755,6 +786,10 @@ gtk_cell_renderer_text_get_property (GObject        *object,
       g_value_set_enum (value, priv->align);
       break;
 
+    case PROP_CACHE_LAYOUTS:
+      g_value_set_boolean (value, priv->cache_layouts);
+      break;
+
     case PROP_BACKGROUND_SET:
       g_value_set_boolean (value, celltext->background_set);
       break;
@@ -822,6 +857,34 @@ gtk_cell_renderer_text_get_property (GObject        *object,
 }
 
 
+static void
+gtk_cell_renderer_text_set_text (GtkCellRendererText *celltext,
+				 const gchar         *text)
+{
+  GtkCellRendererTextPrivate *priv;
+
+  priv = GTK_CELL_RENDERER_TEXT_GET_PRIVATE (celltext);
+
+  g_free (celltext->text);
+
+  if (priv->markup_set)
+    {
+      if (celltext->extra_attrs)
+	pango_attr_list_unref (celltext->extra_attrs);
+      celltext->extra_attrs = NULL;
+      priv->markup_set = FALSE;
+    }
+
+  celltext->text = g_strdup (text);
+}
+
+static void
+gtk_cell_renderer_text_set_text_attribute (GtkCellRenderer *cell,
+					   gconstpointer    data)
+{
+  gtk_cell_renderer_text_set_text ((GtkCellRendererText *) cell, data);
+}
+
 static void
 set_bg_color (GtkCellRendererText *celltext,
               GdkColor            *color)
@@ -1013,17 +1076,7 @@ gtk_cell_renderer_text_set_property (GObject      *object,
   switch (param_id)
     {
     case PROP_TEXT:
-      g_free (celltext->text);
-
-      if (priv->markup_set)
-        {
-          if (celltext->extra_attrs)
-            pango_attr_list_unref (celltext->extra_attrs);
-          celltext->extra_attrs = NULL;
-          priv->markup_set = FALSE;
-        }
-
-      celltext->text = g_strdup (g_value_get_string (value));
+      gtk_cell_renderer_text_set_text (celltext, g_value_get_string (value));
       g_object_notify (object, "text");
       break;
 
@@ -1263,6 +1316,10 @@ gtk_cell_renderer_text_set_property (GObject      *object,
       g_object_notify (object, "align-set");
       break;
 
+    case PROP_CACHE_LAYOUTS:
+      priv->cache_layouts = g_value_get_boolean (value);
+      break;
+
     case PROP_BACKGROUND_SET:
       celltext->background_set = g_value_get_boolean (value);
       break;
@@ -1359,66 +1416,291 @@ add_attr (PangoAttrList  *attr_list,
   pango_attr_list_insert (attr_list, attr);
 }
 
+/* With the cache-layouts property set, layouts built by get_layout()
+ * are cached on the widget the renderer draws on, so that all caching
+ * text renderers of a tree view share them. A row is usually measured
+ * by validate_row(), measured again on expose and then rendered, and
+ * without the cache each of these shapes the text from scratch.
+ */
+#define LAYOUT_CACHE_SIZE 256
+
+/* Passed as the width to get_layout() to get the width implied by
+ * the wrap-width property.
+ */
+#define LAYOUT_DEFAULT_WIDTH -2
+
+typedef struct _LayoutCache      LayoutCache;
+typedef struct _LayoutCacheKey   LayoutCacheKey;
+typedef struct _LayoutCacheEntry LayoutCacheEntry;
+
+struct _LayoutCache
+{
+  GtkStyle *style;
+  cairo_font_options_t *font_options;
+  gdouble resolution;
+  GHashTable *entries;
+  GQueue lru;
+};
+
+/* Everything get_layout() sets on a layout that it doesn't take
+ * from the widget's style and pango context.
+ */
+struct _LayoutCacheKey
+{
+  const gchar *text;		/* Owned by the entry once cached */
+  PangoFontDescription *font;	/* Likewise */
+  PangoLanguage *language;
+  gdouble font_scale;
+  gint direction;
+  gint foreground_red;		/* -1 if no foreground is set */
+  gint foreground_green;
+  gint foreground_blue;
+  gint strikethrough;		/* -1 if not set */
+  gint underline;		/* -1 if none */
+  gint rise;
+  gint single_paragraph;
+  gint ellipsize;
+  gint width;
+  gint wrap;
+  gint align;
+};
+
+struct _LayoutCacheEntry
+{
+  LayoutCacheKey key;
+  PangoLayout *layout;
+  GList *link;
+};
+
+static guint
+layout_cache_key_hash (gconstpointer data)
+{
+  const LayoutCacheKey *key = data;
+  guint hash;
+
+  hash = g_str_hash (key->text);
+  hash = hash * 31 + pango_font_description_hash (key->font);
+  hash = hash * 31 + key->width;
+  hash = hash * 31 + key->foreground_red + key->foreground_green + key->foreground_blue;
+  hash = hash * 31 + key->direction;
+
+  return hash;
+}
+
+static gboolean
+layout_cache_key_equal (gconstpointer a,
+			gconstpointer b)
+{
+  const LayoutCacheKey *key_a = a;
+  const LayoutCacheKey *key_b = b;
+
+  return key_a->width == key_b->width &&
+         key_a->direction == key_b->direction &&
+         key_a->foreground_red == key_b->foreground_red &&
+         key_a->foreground_green == key_b->foreground_green &&
+         key_a->foreground_blue == key_b->foreground_blue &&
+         key_a->strikethrough == key_b->strikethrough &&
+         key_a->underline == key_b->underline &&
+         key_a->rise == key_b->rise &&
+         key_a->single_paragraph == key_b->single_paragraph &&
+         key_a->ellipsize == key_b->ellipsize &&
+         key_a->wrap == key_b->wrap &&
+         key_a->align == key_b->align &&
+         key_a->font_scale == key_b->font_scale &&
+         key_a->language == key_b->language &&
+         strcmp (key_a->text, key_b->text) == 0 &&
+         pango_font_description_equal (key_a->font, key_b->font);
+}
+
+static void
+layout_cache_entry_free (LayoutCacheEntry *entry)
+{
+  g_free ((gchar *) entry->key.text);
+  pango_font_description_free (entry->key.font);
+  g_object_unref (entry->layout);
+  g_slice_free (LayoutCacheEntry, entry);
+}
+
+static void
+layout_cache_clear (LayoutCache *cache)
+{
+  g_hash_table_remove_all (cache->entries);
+  g_queue_clear (&cache->lru);
+}
+
+static void
+layout_cache_free (LayoutCache *cache)
+{
+  layout_cache_clear (cache);
+  g_hash_table_destroy (cache->entries);
+  if (cache->style)
+    g_object_unref (cache->style);
+  if (cache->font_options)
+    cairo_font_options_destroy (cache->font_options);
+  g_slice_free (LayoutCache, cache);
+}
+
+static void
+layout_cache_screen_changed (GtkWidget   *widget,
+			     GdkScreen   *previous_screen,
+			     LayoutCache *cache)
+{
+  layout_cache_clear (cache);
+}
+
+static void
+layout_cache_direction_changed (GtkWidget        *widget,
+				GtkTextDirection  previous_direction,
+				LayoutCache      *cache)
+{
+  layout_cache_clear (cache);
+}
+
+static gboolean
+font_options_equal (const cairo_font_options_t *a,
+		    const cairo_font_options_t *b)
+{
+  if (a == NULL || b == NULL)
+    return a == b;
+
+  return cairo_font_options_equal (a, b);
+}
+
+static LayoutCache *
+layout_cache_get (GtkWidget *widget)
+{
+  static GQuark quark_layout_cache = 0;
+  LayoutCache *cache;
+  PangoContext *context;
+  const cairo_font_options_t *font_options;
+  gdouble resolution;
+
+  if (!quark_layout_cache)
+    quark_layout_cache = g_quark_from_static_string ("gtk-cell-renderer-text-layout-cache");
+
+  cache = g_object_get_qdata (G_OBJECT (widget), quark_layout_cache);
+  if (!cache)
+    {
+      cache = g_slice_new0 (LayoutCache);
+      cache->entries = g_hash_table_new_full (layout_cache_key_hash,
+					      layout_cache_key_equal,
+					      NULL,
+					      (GDestroyNotify) layout_cache_entry_free);
+      g_object_set_qdata_full (G_OBJECT (widget), quark_layout_cache,
+			       cache, (GDestroyNotify) layout_cache_free);
+
+      g_signal_connect (widget, "screen-changed",
+			G_CALLBACK (layout_cache_screen_changed), cache);
+      g_signal_connect (widget, "direction-changed",
+			G_CALLBACK (layout_cache_direction_changed), cache);
+    }
+
+  /* A new style means a new font, and the pango context is updated in
+   * place when the font options or the resolution of the screen change;
+   * either way none of the cached layouts can be reused. Holding a
+   * reference on the style makes sure a later style can't show up at
+   * the same address.
+   */
+  context = gtk_widget_get_pango_context (widget);
+  font_options = pango_cairo_context_get_font_options (context);
+  resolution = pango_cairo_context_get_resolution (context);
+
+  if (cache->style != widget->style ||
+      cache->resolution != resolution ||
+      !font_options_equal (cache->font_options, font_options))
+    {
+      layout_cache_clear (cache);
+      if (cache->style)
+	g_object_unref (cache->style);
+      cache->style = widget->style ? g_object_ref (widget->style) : NULL;
+      if (cache->font_options)
+	cairo_font_options_destroy (cache->font_options);
+      cache->font_options = font_options ? cairo_font_options_copy (font_options) : NULL;
+      cache->resolution = resolution;
+    }
+
+  return cache;
+}
+
+static PangoLayout *
+layout_cache_lookup (LayoutCache          *cache,
+		     const LayoutCacheKey *key)
+{
+  LayoutCacheEntry *entry;
+
+  entry = g_hash_table_lookup (cache->entries, key);
+  if (!entry)
+    return NULL;
+
+  if (entry->link != cache->lru.head)
+    {
+      g_queue_unlink (&cache->lru, entry->link);
+      g_queue_push_head_link (&cache->lru, entry->link);
+    }
+
+  return g_object_ref (entry->layout);
+}
+
+static void
+layout_cache_insert (LayoutCache          *cache,
+		     const LayoutCacheKey *key,
+		     PangoLayout          *layout)
+{
+  LayoutCacheEntry *entry;
+
+  if (g_queue_get_length (&cache->lru) >= LAYOUT_CACHE_SIZE)
+    {
+      entry = g_queue_pop_tail (&cache->lru);
+      g_hash_table_remove (cache->entries, &entry->key);
+    }
+
+  entry = g_slice_new (LayoutCacheEntry);
+  entry->key = *key;
+  entry->key.text = g_strdup (key->text);
+  entry->key.font = pango_font_description_copy (key->font);
+  entry->layout = g_object_ref (layout);
+  g_queue_push_head (&cache->lru, entry);
+  entry->link = cache->lru.head;
+
+  g_hash_table_insert (cache->entries, &entry->key, entry);
+}
+
 static PangoLayout*
 get_layout (GtkCellRendererText *celltext,
             GtkWidget           *widget,
             gboolean             will_render,
-            GtkCellRendererState flags)
+            GtkCellRendererState flags,
+            gint                 width)
 {
   PangoAttrList *attr_list;
   PangoLayout *layout;
   PangoUnderline uline;
+  PangoEllipsizeMode ellipsize;
+  PangoWrapMode wrap;
+  PangoAlignment align;
+  gboolean set_foreground;
+  gboolean set_strikethrough;
+  LayoutCache *cache;
+  LayoutCacheKey key;
   GtkCellRendererTextPrivate *priv;
 
   priv = GTK_CELL_RENDERER_TEXT_GET_PRIVATE (celltext);
-  
-  layout = gtk_widget_create_pango_layout (widget, celltext->text);
 
-  if (celltext->extra_attrs)
-    attr_list = pango_attr_list_copy (celltext->extra_attrs);
-  else
-    attr_list = pango_attr_list_new ();
-
-  pango_layout_set_single_paragraph_mode (layout, priv->single_paragraph);
-
-  if (will_render)
-    {
-      /* Add options that affect appearance but not size */
-      
-      /* note that background doesn't go here, since it affects
-       * background_area not the PangoLayout area
-       */
-      
-      if (celltext->foreground_set
-	  && (flags & GTK_CELL_RENDERER_SELECTED) == 0)
-        {
-          PangoColor color;
-
-          color = celltext->foreground;
-          
-          add_attr (attr_list,
-                    pango_attr_foreground_new (color.red, color.green, color.blue));
-        }
-
-      if (celltext->strikethrough_set)
-        add_attr (attr_list,
-                  pango_attr_strikethrough_new (celltext->strikethrough));
-    }
-
-  add_attr (attr_list, pango_attr_font_desc_new (celltext->font));
+  /* Options that affect appearance but not size only matter when
+   * rendering.
+   *
+   * Note that background doesn't go here, since it affects
+   * background_area not the PangoLayout area
+   */
+  set_foreground = will_render && celltext->foreground_set &&
+                   (flags & GTK_CELL_RENDERER_SELECTED) == 0;
+  set_strikethrough = will_render && celltext->strikethrough_set;
 
-  if (celltext->scale_set &&
-      celltext->font_scale != 1.0)
-    add_attr (attr_list, pango_attr_scale_new (celltext->font_scale));
-  
   if (celltext->underline_set)
     uline = celltext->underline_style;
   else
     uline = PANGO_UNDERLINE_NONE;
 
-  if (priv->language_set)
-    add_attr (attr_list, pango_attr_language_new (priv->language));
-  
   if ((flags & GTK_CELL_RENDERER_PRELIT) == GTK_CELL_RENDERER_PRELIT)
     {
       switch (uline)
@@ -1436,46 +1718,111 @@ get_layout (GtkCellRendererText *celltext,
         }
     }
 
-  if (uline != PANGO_UNDERLINE_NONE)
-    add_attr (attr_list, pango_attr_underline_new (celltext->underline_style));
-
-  if (celltext->rise_set)
-    add_attr (attr_list, pango_attr_rise_new (celltext->rise));
-
   if (priv->ellipsize_set)
-    pango_layout_set_ellipsize (layout, priv->ellipsize);
+    ellipsize = priv->ellipsize;
   else
-    pango_layout_set_ellipsize (layout, PANGO_ELLIPSIZE_NONE);
+    ellipsize = PANGO_ELLIPSIZE_NONE;
 
   if (priv->wrap_width != -1)
+    wrap = priv->wrap_mode;
+  else
+    wrap = PANGO_WRAP_CHAR;
+
+  if (width == LAYOUT_DEFAULT_WIDTH)
     {
-      pango_layout_set_width (layout, priv->wrap_width * PANGO_SCALE);
-      pango_layout_set_wrap (layout, priv->wrap_mode);
+      if (priv->wrap_width != -1)
+        width = priv->wrap_width * PANGO_SCALE;
+      else
+        width = -1;
     }
+
+  if (priv->align_set)
+    align = priv->align;
+  else if (gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL)
+    align = PANGO_ALIGN_RIGHT;
   else
+    align = PANGO_ALIGN_LEFT;
+
+  /* Layouts with extra attributes from the markup or attributes
+   * properties are not cached, there is no cheap way to compare
+   * attribute lists.
+   */
+  cache = NULL;
+  if (priv->cache_layouts && !celltext->extra_attrs)
     {
-      pango_layout_set_width (layout, -1);
-      pango_layout_set_wrap (layout, PANGO_WRAP_CHAR);
+      key.text = celltext->text ? celltext->text : "";
+      key.font = celltext->font;
+      key.language = priv->language_set ? priv->language : NULL;
+      key.font_scale = celltext->scale_set ? celltext->font_scale : 1.0;
+      key.direction = gtk_widget_get_direction (widget);
+      key.foreground_red = set_foreground ? celltext->foreground.red : -1;
+      key.foreground_green = set_foreground ? celltext->foreground.green : -1;
+      key.foreground_blue = set_foreground ? celltext->foreground.blue : -1;
+      key.strikethrough = set_strikethrough ? celltext->strikethrough : -1;
+      key.underline = uline != PANGO_UNDERLINE_NONE ? (gint) celltext->underline_style : -1;
+      key.rise = celltext->rise_set ? celltext->rise : 0;
+      key.single_paragraph = priv->single_paragraph;
+      key.ellipsize = ellipsize;
+      key.width = width;
+      key.wrap = wrap;
+      key.align = align;
+
+      cache = layout_cache_get (widget);
+      layout = layout_cache_lookup (cache, &key);
+      if (layout)
+        return layout;
     }
 
-  if (priv->align_set)
-    pango_layout_set_alignment (layout, priv->align);
+  layout = gtk_widget_create_pango_layout (widget, celltext->text);
+
+  if (celltext->extra_attrs)
+    attr_list = pango_attr_list_copy (celltext->extra_attrs);
   else
+    attr_list = pango_attr_list_new ();
+
+  pango_layout_set_single_paragraph_mode (layout, priv->single_paragraph);
+
+  if (set_foreground)
     {
-      PangoAlignment align;
+      PangoColor color;
 
-      if (gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL)
-	align = PANGO_ALIGN_RIGHT;
-      else
-	align = PANGO_ALIGN_LEFT;
+      color = celltext->foreground;
 
-      pango_layout_set_alignment (layout, align);
+      add_attr (attr_list,
+                pango_attr_foreground_new (color.red, color.green, color.blue));
     }
 
+  if (set_strikethrough)
+    add_attr (attr_list,
+              pango_attr_strikethrough_new (celltext->strikethrough));
+
+  add_attr (attr_list, pango_attr_font_desc_new (celltext->font));
+
+  if (celltext->scale_set &&
+      celltext->font_scale != 1.0)
+    add_attr (attr_list, pango_attr_scale_new (celltext->font_scale));
+
+  if (priv->language_set)
+    add_attr (attr_list, pango_attr_language_new (priv->language));
+
+  if (uline != PANGO_UNDERLINE_NONE)
+    add_attr (attr_list, pango_attr_underline_new (celltext->underline_style));
+
+  if (celltext->rise_set)
+    add_attr (attr_list, pango_attr_rise_new (celltext->rise));
+
+  pango_layout_set_ellipsize (layout, ellipsize);
+  pango_layout_set_width (layout, width);
+  pango_layout_set_wrap (layout, wrap);
+  pango_layout_set_alignment (layout, align);
+
   pango_layout_set_attributes (layout, attr_list);
 
   pango_attr_list_unref (attr_list);
-  
+
+  if (cache)
+    layout_cache_insert (cache, &key, layout);
+
   return layout;
 }
 
@@ -1537,7 +1884,7 @@ get_size (GtkCellRenderer *cell,
   if (layout)
     g_object_ref (layout);
   else
-    layout = get_layout (celltext, widget, FALSE, 0);
+    layout = get_layout (celltext, widget, FALSE, 0, LAYOUT_DEFAULT_WIDTH);
 
   pango_layout_get_pixel_extents (layout, NULL, &rect);
 
@@ -1627,7 +1974,7 @@ gtk_cell_renderer_text_render (GtkCellRenderer      *cell,
 
   priv = GTK_CELL_RENDERER_TEXT_GET_PRIVATE (cell);
 
-  layout = get_layout (celltext, widget, TRUE, flags);
+  layout = get_layout (celltext, widget, TRUE, flags, LAYOUT_DEFAULT_WIDTH);
   get_size (cell, widget, cell_area, layout, &x_offset, &y_offset, NULL, NULL);
 
   if (!cell->sensitive) 
@@ -1675,11 +2022,21 @@ gtk_cell_renderer_text_render (GtkCellRenderer      *cell,
       cairo_destroy (cr);
     }
 
+  /* A cached layout may be shared with other rows, so get a separate
+   * one for the ellipsized width instead of changing this one.
+   */
   if (priv->ellipsize_set && priv->ellipsize != PANGO_ELLIPSIZE_NONE)
-    pango_layout_set_width (layout, 
-			    (cell_area->width - x_offset - 2 * cell->xpad) * PANGO_SCALE);
-  else if (priv->wrap_width == -1)
-    pango_layout_set_width (layout, -1);
+    {
+      gint width = MAX ((cell_area->width - x_offset - 2 * cell->xpad) * PANGO_SCALE, -1);
+
+      if (priv->cache_layouts)
+        {
+          g_object_unref (layout);
+          layout = get_layout (celltext, widget, TRUE, flags, width);
+        }
+      else
+        pango_layout_set_width (layout, width);
+    }
 
   gtk_paint_layout (widget->style,
                     window,
@@ -55,6 +55,8 @@ static gboolean gtk_cell_renderer_toggle_activate  (GtkCellRenderer            *
 						    GdkRectangle               *background_area,
 						    GdkRectangle               *cell_area,
 						    GtkCellRendererState        flags);
+static void gtk_cell_renderer_toggle_set_active_attribute (GtkCellRenderer *cell,
+							   gconstpointer    data);
 
 
 enum {
@@ -119,6 +121,9 @@ gtk_cell_renderer_toggle_class_init (GtkCellRendererToggleClass *class)
   cell_class->get_size = gtk_cell_renderer_toggle_get_size;
   cell_class->render = gtk_cell_renderer_toggle_render;
   cell_class->activate = gtk_cell_renderer_toggle_activate;
+
+  _gtk_cell_renderer_class_install_attribute_setter (cell_class, "active",
+						     gtk_cell_renderer_toggle_set_active_attribute);
   
   g_object_class_install_property (object_class,
 				   PROP_ACTIVE,
@@ -253,6 +258,13 @@ gtk_cell_renderer_toggle_set_property (GObject      *object,
     }
 }
 
+static void
+gtk_cell_renderer_toggle_set_active_attribute (GtkCellRenderer *cell,
+					       gconstpointer    data)
+{
+  ((GtkCellRendererToggle *) cell)->active = GPOINTER_TO_INT (data) != FALSE;
+}
+
 /**
  * gtk_cell_renderer_toggle_new:
  *
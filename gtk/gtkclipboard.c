@@ -47,6 +47,7 @@ enum {
 typedef struct _GtkClipboardClass GtkClipboardClass;
 
 typedef struct _RequestContentsInfo RequestContentsInfo;
+typedef struct _RequestChunksInfo RequestChunksInfo;
 typedef struct _RequestTextInfo RequestTextInfo;
 typedef struct _RequestRichTextInfo RequestRichTextInfo;
 typedef struct _RequestImageInfo RequestImageInfo;
@@ -94,6 +95,14 @@ struct _RequestContentsInfo
   gpointer user_data;
 };
 
+struct _RequestChunksInfo
+{
+  GtkClipboard *clipboard;
+  GtkWidget *widget;
+  GtkClipboardChunkReceivedFunc callback;
+  gpointer user_data;
+};
+
 struct _RequestTextInfo
 {
   GtkClipboardTextReceivedFunc callback;
@@ -921,6 +930,83 @@ gtk_clipboard_request_contents (GtkClipboard            *clipboard,
 			 clipboard_get_timestamp (clipboard));
 }
 
+static void
+request_chunk_received (GtkSelectionData *chunk,
+			gpointer          data)
+{
+  RequestChunksInfo *info = data;
+
+  info->callback (info->clipboard, chunk, info->user_data);
+}
+
+static gboolean
+request_chunks_destroy_widget (gpointer data)
+{
+  gtk_widget_destroy (data);
+
+  return FALSE;
+}
+
+static void
+request_chunks_done (gpointer data)
+{
+  RequestChunksInfo *info = data;
+
+  /* We may be called from an event handler on the widget itself,
+   * so don't destroy it right away.
+   */
+  gdk_threads_add_idle (request_chunks_destroy_widget, info->widget);
+  g_free (info);
+}
+
+/**
+ * gtk_clipboard_request_contents_streamed:
+ * @clipboard: a #GtkClipboard
+ * @target:    an atom representing the form into which the clipboard
+ *             owner should convert the selection.
+ * @callback:  A function to call with each piece of the data as it
+ *             is received.
+ * @user_data: user data to pass to @callback
+ *
+ * Requests the contents of clipboard as the given target, like
+ * gtk_clipboard_request_contents(), but hands the data to @callback
+ * piece by piece as it arrives instead of collecting all of it first.
+ * For large transfers this means the complete contents never have to
+ * be held in memory by the receiving side.
+ *
+ * After the last piece, @callback is called once more with a chunk of
+ * length 0. If the retrieval fails, that final call has a negative
+ * length instead.
+ *
+ * Use gtk_selection_data_set_stream() in the #GtkClipboardGetFunc to
+ * avoid holding the complete contents in memory on the sending side.
+ *
+ * Since: 2.18
+ **/
+void
+gtk_clipboard_request_contents_streamed (GtkClipboard                  *clipboard,
+					 GdkAtom                        target,
+					 GtkClipboardChunkReceivedFunc  callback,
+					 gpointer                       user_data)
+{
+  RequestChunksInfo *info;
+
+  g_return_if_fail (clipboard != NULL);
+  g_return_if_fail (target != GDK_NONE);
+  g_return_if_fail (callback != NULL);
+
+  info = g_new (RequestChunksInfo, 1);
+  info->clipboard = clipboard;
+  info->widget = make_clipboard_widget (clipboard->display, FALSE);
+  info->callback = callback;
+  info->user_data = user_data;
+
+  gtk_selection_convert_streamed (info->widget, clipboard->selection, target,
+				  clipboard_get_timestamp (clipboard),
+				  request_chunk_received, info,
+				  request_chunks_done);
+}
+
 static void 
 request_text_received_func (GtkClipboard     *clipboard,
 			    GtkSelectionData *selection_data,
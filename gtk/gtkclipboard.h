@@ -55,6 +55,9 @@ typedef void (* GtkClipboardTargetsReceivedFunc)  (GtkClipboard     *clipboard,
 					           GdkAtom          *atoms,
 						   gint              n_atoms,
 					           gpointer          data);
+typedef void (* GtkClipboardChunkReceivedFunc)    (GtkClipboard     *clipboard,
+					           GtkSelectionData *chunk,
+					           gpointer          data);
 
 /* Should these functions have GtkClipboard *clipboard as the first argument?
  * right now for ClearFunc, you may have trouble determining _which_ clipboard
@@ -102,6 +105,10 @@ void gtk_clipboard_request_contents  (GtkClipboard                     *clipboar
                                       GdkAtom                           target,
                                       GtkClipboardReceivedFunc          callback,
                                       gpointer                          user_data);
+void gtk_clipboard_request_contents_streamed (GtkClipboard                  *clipboard,
+                                              GdkAtom                        target,
+                                              GtkClipboardChunkReceivedFunc  callback,
+                                              gpointer                       user_data);
 void gtk_clipboard_request_text      (GtkClipboard                     *clipboard,
                                       GtkClipboardTextReceivedFunc      callback,
                                       gpointer                          user_data);
@@ -58,6 +58,13 @@ typedef struct
   gint wrap_width;
   gint width_chars;
   gint max_width_chars;
+
+  /* The inputs of the width search done for wrapping labels in
+   * gtk_label_ensure_layout(); as long as they don't change, the
+   * layout can be kept across size requests.
+   */
+  gint layout_aux_width;
+  gint layout_screen_width;
 } GtkLabelPrivate;
 
 /* Notes about the handling of links:
@@ -994,6 +1001,8 @@ gtk_label_init (GtkLabel *label)
   priv->width_chars = -1;
   priv->max_width_chars = -1;
   priv->wrap_width = -1;
+  priv->layout_aux_width = -1;
+  priv->layout_screen_width = -1;
   label->label = NULL;
 
   label->jtype = GTK_JUSTIFY_LEFT;
@@ -1819,6 +1828,16 @@ gtk_label_set_text (GtkLabel    *label,
 		    const gchar *str)
 {
   g_return_if_fail (GTK_IS_LABEL (label));
+
+  /* Labels showing periodically refreshed values are often set to
+   * the text they already have; keep the layout in that case, as
+   * long as setting the text would not also drop a pattern or other
+   * derived attributes.
+   */
+  if (!label->use_markup && !label->use_underline && !label->select_info &&
+      !label->pattern_set && label->effective_attrs == label->attrs &&
+      g_strcmp0 (label->label, str ? str : "") == 0)
+    return;
   
   g_object_freeze_notify (G_OBJECT (label));
 
@@ -2799,9 +2818,12 @@ get_label_char_width (GtkLabel *label)
   if (priv->width_chars < 0)
     {
       PangoRectangle rect;
-      
+      gint layout_width;
+
+      layout_width = pango_layout_get_width (label->layout);
       pango_layout_set_width (label->layout, -1);
       pango_layout_get_extents (label->layout, NULL, &rect);
+      pango_layout_set_width (label->layout, layout_width);
       
       w = char_pixels * MAX (priv->max_width_chars, 3);
       w = MIN (rect.width, w);
@@ -2823,6 +2845,8 @@ gtk_label_invalidate_wrap_width (GtkLabel *label)
   priv = GTK_LABEL_GET_PRIVATE (label);
 
   priv->wrap_width = -1;
+  /* Make the next size request redo the wrap width search */
+  priv->layout_screen_width = -1;
 }
 
 static gint
@@ -2850,14 +2874,40 @@ get_label_wrap_width (GtkLabel *label)
   return priv->wrap_width;
 }
 
+/* Checks whether the layout of a wrapping label was made for the
+ * current size request width and screen, so that the comparatively
+ * expensive search for a good wrap width can be skipped.
+ */
+static gboolean
+gtk_label_wrap_layout_is_valid (GtkLabel *label)
+{
+  GtkWidget *widget = GTK_WIDGET (label);
+  GtkLabelPrivate *priv;
+  GtkWidgetAuxInfo *aux_info;
+  gint aux_width;
+
+  priv = GTK_LABEL_GET_PRIVATE (label);
+
+  if (!label->layout || label->ellipsize)
+    return FALSE;
+
+  aux_info = _gtk_widget_get_aux_info (widget, FALSE);
+  aux_width = aux_info ? aux_info->width : -1;
+
+  return priv->layout_aux_width == aux_width &&
+    priv->layout_screen_width == gdk_screen_get_width (gtk_widget_get_screen (widget));
+}
+
 static void
 gtk_label_ensure_layout (GtkLabel *label)
 {
   GtkWidget *widget;
+  GtkLabelPrivate *priv;
   PangoRectangle logical_rect;
   gboolean rtl;
 
   widget = GTK_WIDGET (label);
+  priv = GTK_LABEL_GET_PRIVATE (label);
 
   rtl = gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL;
 
@@ -2930,6 +2980,9 @@ gtk_label_ensure_layout (GtkLabel *label)
 	  pango_layout_set_wrap (label->layout, label->wrap_mode);
 	  
 	  aux_info = _gtk_widget_get_aux_info (widget, FALSE);
+	  priv->layout_aux_width = aux_info ? aux_info->width : -1;
+	  priv->layout_screen_width = gdk_screen_get_width (gtk_widget_get_screen (widget));
+
 	  if (aux_info && aux_info->width > 0)
 	    pango_layout_set_width (label->layout, aux_info->width * PANGO_SCALE);
 	  else
@@ -3014,13 +3067,13 @@ gtk_label_size_request (GtkWidget      *widget,
    *   - Any width set on the widget via gtk_widget_set_size_request().
    *   - The padding of the widget (xpad, set by gtk_misc_set_padding)
    *
-   * Instead of trying to detect changes to these quantities, if we
-   * are wrapping, we just rewrap for each size request. Since
-   * size requisitions are cached by the GTK+ core, this is not
-   * expensive.
+   * The padding does not enter into the width search in
+   * gtk_label_ensure_layout(), so we only need to rewrap if the
+   * width request (or the screen) changed since the layout was
+   * made. Text, attribute and font changes clear the layout anyway.
    */
 
-  if (label->wrap)
+  if (label->wrap && !gtk_label_wrap_layout_is_valid (label))
     gtk_label_clear_layout (label);
 
   gtk_label_ensure_layout (label);
@@ -3173,9 +3226,20 @@ gtk_label_style_set (GtkWidget *widget,
 {
   GtkLabel *label = GTK_LABEL (widget);
 
-  /* We have to clear the layout, fonts etc. may have changed */
-  gtk_label_clear_layout (label);
-  gtk_label_invalidate_wrap_width (label);
+  /* We have to clear the layout, fonts etc. may have changed. If the
+   * font stayed the same, as when only colors changed, keeping the
+   * layout (and its wrap width) is enough; it just has to pick up
+   * changes of the context such as the resolution.
+   */
+  if (label->layout && previous_style &&
+      pango_font_description_equal (previous_style->font_desc,
+				    widget->style->font_desc))
+    pango_layout_context_changed (label->layout);
+  else
+    {
+      gtk_label_clear_layout (label);
+      gtk_label_invalidate_wrap_width (label);
+    }
 }
 
 static void 
@@ -74,6 +74,10 @@
 
 #undef DEBUG_SELECTION
 
+/* Size of the chunks we pull from a stream when there is no X
+   request size limit to follow */
+#define GTK_SELECTION_STREAM_CHUNK_SIZE 262144
+
 /* Maximum size of a sent chunk, in bytes. Also the default size of
    our buffers */
 #ifdef GDK_WINDOWING_X11
@@ -99,6 +103,8 @@ enum {
 };
 
 typedef struct _GtkSelectionInfo GtkSelectionInfo;
+typedef struct _GtkSelectionStream GtkSelectionStream;
+typedef struct _GtkStreamRequest GtkStreamRequest;
 typedef struct _GtkIncrConversion GtkIncrConversion;
 typedef struct _GtkIncrInfo GtkIncrInfo;
 typedef struct _GtkRetrievalInfo GtkRetrievalInfo;
@@ -111,11 +117,30 @@ struct _GtkSelectionInfo
   GdkDisplay	*display;	/* needed in gtk_selection_remove_all */    
 };
 
+struct _GtkSelectionStream
+{
+  GtkSelectionStreamFunc func;	/* Produces the data chunk by chunk */
+  gpointer	    user_data;
+  GDestroyNotify    destroy;
+  gint		    length_hint; /* Expected total length, or 0 */
+};
+
+/* A request in progress whose selection handler may supply a stream.
+ * Lives on the stack of the caller for the duration of the handler.
+ */
+struct _GtkStreamRequest
+{
+  GtkSelectionData   *selection_data;
+  GtkSelectionStream *stream;	/* Set by gtk_selection_data_set_stream() */
+};
+
 struct _GtkIncrConversion 
 {
   GdkAtom	    target;	/* Requested target */
   GdkAtom	    property;	/* Property to store in */
   GtkSelectionData  data;	/* The data being supplied */
+  GtkSelectionStream *stream;	/* If not %NULL, data.data is only a
+				 * buffer for the current chunk */
   gint		    offset;	/* Current offset in sent selection.
 				 *  -1 => All done
 				 *  -2 => Only the final (empty) portion
@@ -149,10 +174,27 @@ struct _GtkRetrievalInfo
   gint	   offset;		/* Current offset in buffer, -1 indicates
 				   not yet started */
   guint32 notify_time;		/* Timestamp from SelectionNotify */
+  GtkSelectionChunkFunc chunk_func; /* If set, data is handed out as
+				     * it arrives instead of being
+				     * accumulated in buffer */
+  gpointer chunk_data;
+  GDestroyNotify chunk_destroy;
 };
 
 /* Local Functions */
 static void gtk_selection_init              (void);
+static gboolean gtk_selection_convert_internal (GtkWidget            *widget,
+						GdkAtom               selection,
+						GdkAtom               target,
+						guint32               time_,
+						GtkSelectionChunkFunc chunk_func,
+						gpointer              chunk_data,
+						GDestroyNotify        chunk_destroy);
+static void gtk_selection_retrieval_chunk   (GtkRetrievalInfo *info,
+					     GdkAtom           type,
+					     gint              format,
+					     guchar           *buffer,
+					     gint              length);
 static gboolean gtk_selection_incr_timeout      (GtkIncrInfo      *info);
 static gboolean gtk_selection_retrieval_timeout (GtkRetrievalInfo *info);
 static void gtk_selection_retrieval_report  (GtkRetrievalInfo *info,
@@ -167,12 +209,23 @@ static void gtk_selection_invoke_handler    (GtkWidget        *widget,
 static void gtk_selection_default_handler   (GtkWidget        *widget,
 					     GtkSelectionData *data);
 static int  gtk_selection_bytes_per_item    (gint              format);
+static void gtk_selection_stream_request_begin (GtkStreamRequest   *request,
+						GtkSelectionData   *selection_data);
+static GtkSelectionStream *gtk_selection_stream_request_end (GtkStreamRequest *request);
+static GtkStreamRequest *gtk_selection_stream_request_lookup (GtkSelectionData *selection_data);
+static gint gtk_selection_stream_read       (GtkSelectionStream *stream,
+					     GtkSelectionData   *data,
+					     gint                max_length);
+static void gtk_selection_stream_drain      (GtkSelectionStream *stream,
+					     GtkSelectionData   *data);
+static void gtk_selection_stream_free       (GtkSelectionStream *stream);
 
 /* Local Data */
 static gint initialize = TRUE;
 static GList *current_retrievals = NULL;
 static GList *current_incrs = NULL;
 static GList *current_selections = NULL;
+static GSList *current_stream_requests = NULL;
 
 static GdkAtom gtk_selection_atoms[LAST_ATOM];
 static const char gtk_selection_handler_key[] = "gtk-selection-handlers";
@@ -961,13 +1014,22 @@ gtk_selection_remove_all (GtkWidget *widget)
   tmp_list = current_retrievals;
   while (tmp_list)
     {
+      GtkRetrievalInfo *info = tmp_list->data;
+
       next = tmp_list->next;
-      if (((GtkRetrievalInfo *)tmp_list->data)->widget == widget)
+      if (info->widget == widget)
 	{
-	  current_retrievals = g_list_remove_link (current_retrievals, 
+	  current_retrievals = g_list_remove_link (current_retrievals,
 						   tmp_list);
 	  /* structure will be freed in timeout */
 	  g_list_free (tmp_list);
+
+	  /* The timeout won't report an unlisted retrieval, so end a
+	   * streamed one here to let the consumer clean up.
+	   */
+	  if (info->chunk_func)
+	    gtk_selection_retrieval_report (info, GDK_NONE, 0, NULL, -1,
+					    GDK_CURRENT_TIME);
 	}
       tmp_list = next;
     }
@@ -1020,6 +1082,61 @@ gtk_selection_convert (GtkWidget *widget,
 		       GdkAtom	  selection, 
 		       GdkAtom	  target,
 		       guint32	  time_)
+{
+  return gtk_selection_convert_internal (widget, selection, target, time_,
+					 NULL, NULL, NULL);
+}
+
+/**
+ * gtk_selection_convert_streamed:
+ * @widget: The widget which acts as requestor
+ * @selection: Which selection to get
+ * @target: Form of information desired (e.g., STRING)
+ * @time_: Time of request (usually of triggering event)
+ * @func: function to call for each chunk of data as it arrives
+ * @user_data: user data to pass to @func
+ * @destroy: function to call on @user_data when the retrieval is done,
+ *   or %NULL
+ *
+ * Like gtk_selection_convert(), but instead of collecting the complete
+ * contents of the selection in memory and emitting "selection-received"
+ * once, @func is called with each piece of data as it is received from
+ * the selection owner. This keeps memory use bounded for very large
+ * transfers that use the INCR protocol.
+ *
+ * After all data has been passed to @func, it is called a final time
+ * with a #GtkSelectionData of length 0. If the retrieval fails, the
+ * final call has a negative length instead.
+ *
+ * Return value: %TRUE if requested succeeded. %FALSE if we could not process
+ *          request. (e.g., there was already a request in process for
+ *          this widget). In that case, @func is not called.
+ *
+ * Since: 2.18
+ **/
+gboolean
+gtk_selection_convert_streamed (GtkWidget            *widget,
+				GdkAtom               selection,
+				GdkAtom               target,
+				guint32               time_,
+				GtkSelectionChunkFunc func,
+				gpointer              user_data,
+				GDestroyNotify        destroy)
+{
+  g_return_val_if_fail (func != NULL, FALSE);
+
+  return gtk_selection_convert_internal (widget, selection, target, time_,
+					 func, user_data, destroy);
+}
+
+static gboolean
+gtk_selection_convert_internal (GtkWidget            *widget,
+				GdkAtom               selection,
+				GdkAtom               target,
+				guint32               time_,
+				GtkSelectionChunkFunc chunk_func,
+				gpointer              chunk_data,
+				GDestroyNotify        chunk_destroy)
 {
   GtkRetrievalInfo *info;
   GList *tmp_list;
@@ -1046,7 +1163,11 @@ gtk_selection_convert (GtkWidget *widget,
     {
       info = (GtkRetrievalInfo *)tmp_list->data;
       if (info->widget == widget)
-	return FALSE;
+	{
+	  if (chunk_destroy)
+	    chunk_destroy (chunk_data);
+	  return FALSE;
+	}
       tmp_list = tmp_list->next;
     }
   
@@ -1058,6 +1179,9 @@ gtk_selection_convert (GtkWidget *widget,
   info->idle_time = 0;
   info->buffer = NULL;
   info->offset = -1;
+  info->chunk_func = chunk_func;
+  info->chunk_data = chunk_data;
+  info->chunk_destroy = chunk_destroy;
   
   /* Check if this process has current owner. If so, call handler
      procedure directly to avoid deadlocks with INCR. */
@@ -1082,9 +1206,33 @@ gtk_selection_convert (GtkWidget *widget,
       
       if (owner_widget != NULL)
 	{
+	  GtkStreamRequest request;
+	  GtkSelectionStream *stream;
+
+	  gtk_selection_stream_request_begin (&request, &selection_data);
 	  gtk_selection_invoke_handler (owner_widget, 
 					&selection_data,
 					time_);
+	  stream = gtk_selection_stream_request_end (&request);
+	  if (stream && info->chunk_func)
+	    {
+	      gint length;
+
+	      while ((length = gtk_selection_stream_read (stream, &selection_data,
+							 GTK_SELECTION_STREAM_CHUNK_SIZE)) > 0)
+		gtk_selection_retrieval_chunk (info,
+					       selection_data.type,
+					       selection_data.format,
+					       selection_data.data,
+					       length);
+
+	      gtk_selection_stream_free (stream);
+	      g_free (selection_data.data);
+	      selection_data.data = NULL;
+	      selection_data.length = length;
+	    }
+	  else if (stream)
+	    gtk_selection_stream_drain (stream, &selection_data);
 	  
 	  gtk_selection_retrieval_report (info,
 					  selection_data.type, 
@@ -1257,8 +1405,18 @@ gtk_selection_data_set (GtkSelectionData *selection_data,
 			const guchar	 *data,
 			gint		  length)
 {
+  GtkStreamRequest *request;
+
   g_return_if_fail (selection_data != NULL);
 
+  /* Replaces a stream set earlier by the same handler */
+  request = gtk_selection_stream_request_lookup (selection_data);
+  if (request && request->stream)
+    {
+      gtk_selection_stream_free (request->stream);
+      request->stream = NULL;
+    }
+
   g_free (selection_data->data);
   
   selection_data->type = type;
@@ -1283,6 +1441,80 @@ gtk_selection_data_set (GtkSelectionData *selection_data,
   selection_data->length = length;
 }
 
+/**
+ * gtk_selection_data_set_stream:
+ * @selection_data: a pointer to a #GtkSelectionData structure.
+ * @type: the type of selection data
+ * @format: format (number of bits in a unit)
+ * @length_hint: the expected total length of the data in bytes,
+ *   or 0 if unknown
+ * @func: function to call to produce the data
+ * @user_data: user data to pass to @func
+ * @destroy: function to call on @user_data when the transfer is
+ *   finished or aborted, or %NULL
+ *
+ * Supplies the contents of a selection as a stream instead of a
+ * single buffer. Like gtk_selection_data_set(), this should
+ * <emphasis>only</emphasis> be called from a selection handler
+ * callback, such as a #GtkClipboardGetFunc or a "drag-data-get"
+ * handler.
+ *
+ * @func is called repeatedly while the requestor retrieves the data,
+ * each time to fill a buffer of at most @max_length bytes. It returns
+ * the number of bytes it stored, which must be a multiple of the item
+ * size implied by @format, 0 once all data has been produced, or -1 on
+ * error. When the data is sent to another client, it is transferred
+ * with the INCR protocol one chunk at a time, so the complete data
+ * never needs to be held in memory.
+ *
+ * If the handler was not invoked by GTK+ for a selection request, for
+ * example when "selection-get" is emitted directly, @func is called
+ * right away until all data has been produced, and the result is
+ * stored in @selection_data as if gtk_selection_data_set() had been
+ * used.
+ *
+ * Since: 2.18
+ **/
+void
+gtk_selection_data_set_stream (GtkSelectionData      *selection_data,
+			       GdkAtom                type,
+			       gint                   format,
+			       gint                   length_hint,
+			       GtkSelectionStreamFunc func,
+			       gpointer               user_data,
+			       GDestroyNotify         destroy)
+{
+  GtkStreamRequest *request;
+  GtkSelectionStream *stream;
+
+  g_return_if_fail (selection_data != NULL);
+  g_return_if_fail (format >= 8 && format % 8 == 0);
+  g_return_if_fail (func != NULL);
+
+  g_free (selection_data->data);
+
+  selection_data->type = type;
+  selection_data->format = format;
+  selection_data->data = NULL;
+  selection_data->length = 0;
+
+  stream = g_slice_new (GtkSelectionStream);
+  stream->func = func;
+  stream->user_data = user_data;
+  stream->destroy = destroy;
+  stream->length_hint = MAX (length_hint, 0);
+
+  request = gtk_selection_stream_request_lookup (selection_data);
+  if (request)
+    {
+      if (request->stream)
+	gtk_selection_stream_free (request->stream);
+      request->stream = stream;
+    }
+  else
+    gtk_selection_stream_drain (stream, selection_data);
+}
+
 static gboolean
 selection_set_string (GtkSelectionData *selection_data,
 		      const gchar      *str,
@@ -2362,6 +2594,8 @@ _gtk_selection_request (GtkWidget *widget,
   for (i=0; i<info->num_conversions; i++)
     {
       GtkSelectionData data;
+      GtkStreamRequest request;
+      GtkSelectionStream *stream;
       glong items;
       
       data.selection = event->selection;
@@ -2369,6 +2603,7 @@ _gtk_selection_request (GtkWidget *widget,
       data.data = NULL;
       data.length = -1;
       data.display = gtk_widget_get_display (widget);
+      info->conversions[i].stream = NULL;
       
 #ifdef DEBUG_SELECTION
       g_message ("Selection %ld, target %ld (%s) requested by 0x%x (property = %ld)",
@@ -2378,7 +2613,18 @@ _gtk_selection_request (GtkWidget *widget,
 		 event->requestor, info->conversions[i].property);
 #endif
       
+      gtk_selection_stream_request_begin (&request, &data);
       gtk_selection_invoke_handler (widget, &data, event->time);
+      stream = gtk_selection_stream_request_end (&request);
+#ifndef GDK_WINDOWING_X11
+      /* No INCR here, so the whole stream has to go at once */
+      if (stream)
+	{
+	  gtk_selection_stream_drain (stream, &data);
+	  stream = NULL;
+	}
+#endif
+
       if (data.length < 0)
 	{
 	  info->conversions[i].property = GDK_NONE;
@@ -2387,18 +2633,25 @@ _gtk_selection_request (GtkWidget *widget,
       
       g_return_val_if_fail ((data.format >= 8) && (data.format % 8 == 0), FALSE);
       
-      items = data.length / gtk_selection_bytes_per_item (data.format);
+      if (stream)
+	items = stream->length_hint / gtk_selection_bytes_per_item (data.format);
+      else
+	items = data.length / gtk_selection_bytes_per_item (data.format);
       
-      if (data.length > selection_max_size)
+      if (stream || data.length > selection_max_size)
 	{
 	  /* Sending via INCR */
 #ifdef DEBUG_SELECTION
-	  g_message ("Target larger (%d) than max. request size (%ld), sending incrementally\n",
-		     data.length, selection_max_size);
+	  if (stream)
+	    g_message ("Target is streamed, sending incrementally\n");
+	  else
+	    g_message ("Target larger (%d) than max. request size (%ld), sending incrementally\n",
+		       data.length, selection_max_size);
 #endif
 	  
 	  info->conversions[i].offset = 0;
 	  info->conversions[i].data = data;
+	  info->conversions[i].stream = stream;
 	  info->num_incrs++;
 	  
 	  gdk_property_change (info->requestor, 
@@ -2558,6 +2811,24 @@ _gtk_selection_incr_event (GdkWindow	   *window,
 	      num_bytes = 0;
 	      buffer = NULL;
 	    }
+	  else if (info->conversions[i].stream)
+	    {
+	      /* Pull the next chunk; on error we just end the transfer,
+	       * since INCR has no way to report failure halfway through.
+	       */
+	      num_bytes = gtk_selection_stream_read (info->conversions[i].stream,
+						     &info->conversions[i].data,
+						     selection_max_size);
+	      buffer = info->conversions[i].data.data;
+
+	      if (num_bytes <= 0)
+		{
+		  num_bytes = 0;
+		  gtk_selection_stream_free (info->conversions[i].stream);
+		  info->conversions[i].stream = NULL;
+		  info->conversions[i].offset = -2;
+		}
+	    }
 	  else
 	    {
 	      num_bytes = info->conversions[i].data.length -
@@ -2642,11 +2913,23 @@ gtk_selection_incr_timeout (GtkIncrInfo *info)
   /* If retrieval is finished */
   if (!tmp_list || info->idle_time >= IDLE_ABORT_TIME)
     {
+      gint i;
+
       if (tmp_list && info->idle_time >= IDLE_ABORT_TIME)
 	{
 	  current_incrs = g_list_remove_link (current_incrs, tmp_list);
 	  g_list_free (tmp_list);
 	}
+
+      for (i = 0; i < info->num_conversions; i++)
+	{
+	  if (info->conversions[i].property != GDK_NONE &&
+	      info->conversions[i].stream)
+	    {
+	      gtk_selection_stream_free (info->conversions[i].stream);
+	      g_free (info->conversions[i].data.data);
+	    }
+	}
       
       g_free (info->conversions);
       /* FIXME: we should check if requestor window is still in use,
@@ -2831,6 +3114,16 @@ _gtk_selection_property_notify (GtkWidget	*widget,
 				      (type == GDK_NONE) ?  -1 : info->offset,
 				      info->notify_time);
     }
+  else if (info->chunk_func)	/* hand out newly arrived data */
+    {
+#ifdef DEBUG_SELECTION
+      g_message ("Passing on %d bytes at offset %d",
+		 length, info->offset);
+#endif
+      info->offset += length;
+      gtk_selection_retrieval_chunk (info, type, format, new_buffer, length);
+      g_free (new_buffer);
+    }
   else				/* append on newly arrived data */
     {
       if (!info->buffer)
@@ -2927,6 +3220,25 @@ gtk_selection_retrieval_report (GtkRetrievalInfo *info,
 				guint32 time)
 {
   GtkSelectionData data;
+
+  if (info->chunk_func)
+    {
+      /* Anything still in the buffer is the only or last chunk; the
+       * call with length 0 (or -1 on error) ends the stream.
+       */
+      if (buffer && length > 0)
+	gtk_selection_retrieval_chunk (info, type, format, buffer, length);
+
+      gtk_selection_retrieval_chunk (info, type, format, NULL,
+				     length < 0 ? -1 : 0);
+
+      if (info->chunk_destroy)
+	info->chunk_destroy (info->chunk_data);
+      info->chunk_func = NULL;
+      info->chunk_destroy = NULL;
+
+      return;
+    }
   
   data.selection = info->selection;
   data.target = info->target;
@@ -2942,6 +3254,39 @@ gtk_selection_retrieval_report (GtkRetrievalInfo *info,
 			 &data, time);
 }
 
+/*************************************************************
+ * gtk_selection_retrieval_chunk:
+ *     Passes one piece of a streamed retrieval to the
+ *     consumer.
+ *   arguments:
+ *     info:	  information about the retrieval
+ *     buffer:	  the data (NULL at the end of the stream)
+ *     length:	  number of bytes in buffer, 0 at the end, -1
+ *		  on error
+ *   results:
+ *************************************************************/
+
+static void
+gtk_selection_retrieval_chunk (GtkRetrievalInfo *info,
+			       GdkAtom           type,
+			       gint              format,
+			       guchar           *buffer,
+			       gint              length)
+{
+  GtkSelectionData data;
+
+  data.selection = info->selection;
+  data.target = info->target;
+  data.type = type;
+  data.format = format;
+
+  data.length = length;
+  data.data = buffer;
+  data.display = gtk_widget_get_display (info->widget);
+
+  info->chunk_func (&data, info->chunk_data);
+}
+
 /*************************************************************
  * gtk_selection_invoke_handler:
  *     Finds and invokes handler for specified
@@ -3146,6 +3491,125 @@ gtk_target_list_get_type (void)
   return our_type;
 }
 
+static void
+gtk_selection_stream_free (GtkSelectionStream *stream)
+{
+  if (stream->destroy)
+    stream->destroy (stream->user_data);
+
+  g_slice_free (GtkSelectionStream, stream);
+}
+
+/* Lets the selection handler invoked for @selection_data between
+ * this and gtk_selection_stream_request_end() supply a stream.
+ */
+static void
+gtk_selection_stream_request_begin (GtkStreamRequest *request,
+				    GtkSelectionData *selection_data)
+{
+  request->selection_data = selection_data;
+  request->stream = NULL;
+
+  current_stream_requests = g_slist_prepend (current_stream_requests, request);
+}
+
+/* Returns the stream set with gtk_selection_data_set_stream() during
+ * the request, if any; the caller is responsible for freeing it.
+ */
+static GtkSelectionStream *
+gtk_selection_stream_request_end (GtkStreamRequest *request)
+{
+  current_stream_requests = g_slist_remove (current_stream_requests, request);
+
+  return request->stream;
+}
+
+static GtkStreamRequest *
+gtk_selection_stream_request_lookup (GtkSelectionData *selection_data)
+{
+  GSList *tmp_list;
+
+  for (tmp_list = current_stream_requests; tmp_list; tmp_list = tmp_list->next)
+    {
+      GtkStreamRequest *request = tmp_list->data;
+
+      if (request->selection_data == selection_data)
+	return request;
+    }
+
+  return NULL;
+}
+
+/* Reads the next chunk of @stream into data->data, which is
+ * allocated on the first call and reused after that. Returns the
+ * number of bytes read, 0 at the end of the stream or -1 on error.
+ */
+static gint
+gtk_selection_stream_read (GtkSelectionStream *stream,
+			   GtkSelectionData   *data,
+			   gint                max_length)
+{
+  gint bytes_per_item;
+  gint length;
+
+  bytes_per_item = gtk_selection_bytes_per_item (data->format);
+  max_length -= max_length % bytes_per_item;
+
+  if (!data->data)
+    data->data = g_malloc (max_length + 1);
+
+  length = stream->func (data, data->data, max_length, stream->user_data);
+
+  if (length < 0)
+    return -1;
+
+  if (length > max_length || length % bytes_per_item != 0)
+    {
+      g_warning ("GtkSelectionStreamFunc returned an invalid length %d",
+		 length);
+      return -1;
+    }
+
+  data->data[length] = 0;
+  data->length = length;
+
+  return length;
+}
+
+/* Collects all of @stream into a single buffer in @data, the same
+ * way gtk_selection_data_set() would have stored it, and frees
+ * @stream.
+ */
+static void
+gtk_selection_stream_drain (GtkSelectionStream *stream,
+			    GtkSelectionData   *data)
+{
+  GByteArray *array;
+  gint length;
+
+  array = g_byte_array_sized_new (stream->length_hint + 1);
+
+  while ((length = gtk_selection_stream_read (stream, data,
+					      GTK_SELECTION_STREAM_CHUNK_SIZE)) > 0)
+    g_byte_array_append (array, data->data, length);
+
+  g_free (data->data);
+  gtk_selection_stream_free (stream);
+
+  if (length < 0)
+    {
+      g_byte_array_free (array, TRUE);
+      data->data = NULL;
+      data->length = -1;
+    }
+  else
+    {
+      data->length = array->len;
+      g_byte_array_append (array, (const guint8 *) "", 1);
+      data->data = g_byte_array_free (array, FALSE);
+    }
+}
+
 static int 
 gtk_selection_bytes_per_item (gint format)
 {
@@ -66,6 +66,19 @@ struct _GtkSelectionData
   GdkDisplay   *GSEAL (display);
 };
 
+/* Produces the next chunk of a streamed selection; see
+ * gtk_selection_data_set_stream().
+ */
+typedef gint (*GtkSelectionStreamFunc) (GtkSelectionData *selection_data,
+					guchar           *buffer,
+					gint              max_length,
+					gpointer          user_data);
+/* Receives the chunks of a streamed retrieval; see
+ * gtk_selection_convert_streamed().
+ */
+typedef void (*GtkSelectionChunkFunc)  (GtkSelectionData *chunk,
+					gpointer          user_data);
+
 struct _GtkTargetEntry {
   gchar *target;
   guint  flags;
@@ -147,6 +160,13 @@ gboolean gtk_selection_convert       (GtkWidget            *widget,
 				      GdkAtom               selection,
 				      GdkAtom               target,
 				      guint32               time_);
+gboolean gtk_selection_convert_streamed (GtkWidget            *widget,
+					 GdkAtom               selection,
+					 GdkAtom               target,
+					 guint32               time_,
+					 GtkSelectionChunkFunc func,
+					 gpointer              user_data,
+					 GDestroyNotify        destroy);
 
 GdkAtom       gtk_selection_data_get_selection (GtkSelectionData *selection_data);
 GdkAtom       gtk_selection_data_get_target    (GtkSelectionData *selection_data);
@@ -161,6 +181,13 @@ void     gtk_selection_data_set      (GtkSelectionData     *selection_data,
 				      gint                  format,
 				      const guchar         *data,
 				      gint                  length);
+void     gtk_selection_data_set_stream (GtkSelectionData      *selection_data,
+					GdkAtom                type,
+					gint                   format,
+					gint                   length_hint,
+					GtkSelectionStreamFunc func,
+					gpointer               user_data,
+					GDestroyNotify         destroy);
 gboolean gtk_selection_data_set_text (GtkSelectionData     *selection_data,
 				      const gchar          *str,
 				      gint                  len);
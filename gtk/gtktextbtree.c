@@ -213,8 +213,24 @@ struct _GtkTextBTree {
   guint end_iter_segment_stamp;
   
   GHashTable *child_anchor_table;
+
+  /* While tag redisplay is frozen, the character ranges that need
+   * to be relaid out or redrawn because of tag changes are collected
+   * here, as sorted arrays of disjoint TagRedisplayRanges, and handled
+   * in one go when it is thawed. Text inserted or deleted in between
+   * moves the ranges along.
+   */
+  guint tag_redisplay_freeze_count;
+  GArray *tag_invalidate_ranges;
+  GArray *tag_redisplay_ranges;
 };
 
+typedef struct
+{
+  gint start;
+  gint end;
+} TagRedisplayRange;
+
 
 /*
  * Upper and lower bounds on how many children a node may have:
@@ -272,6 +288,10 @@ static void             gtk_text_line_set_parent        (GtkTextLine      *line,
                                                          GtkTextBTreeNode *node);
 static void             gtk_text_btree_node_remove_data (GtkTextBTreeNode *node,
                                                          gpointer          view_id);
+static void             tag_redisplay_text_changed      (GtkTextBTree      *tree,
+                                                         const GtkTextIter *start,
+                                                         gint               n_deleted,
+                                                         gint               n_inserted);
 
 
 static NodeData         *node_data_new          (gpointer  view_id);
@@ -436,6 +456,10 @@ _gtk_text_btree_new (GtkTextTagTable *table,
 
   tree->mark_table = g_hash_table_new (g_str_hash, g_str_equal);
   tree->child_anchor_table = NULL;
+
+  tree->tag_redisplay_freeze_count = 0;
+  tree->tag_invalidate_ranges = g_array_new (FALSE, FALSE, sizeof (TagRedisplayRange));
+  tree->tag_redisplay_ranges = g_array_new (FALSE, FALSE, sizeof (TagRedisplayRange));
   
   /* We don't ref the buffer, since the buffer owns us;
    * we'd have some circularity issues. The buffer always
@@ -524,6 +548,9 @@ _gtk_text_btree_unref (GtkTextBTree *tree)
       g_object_unref (tree->selection_bound_mark);
       tree->selection_bound_mark = NULL;
 
+      g_array_free (tree->tag_invalidate_ranges, TRUE);
+      g_array_free (tree->tag_redisplay_ranges, TRUE);
+
       g_free (tree);
     }
 }
@@ -759,6 +786,10 @@ _gtk_text_btree_delete (GtkTextIter *start,
   DV (g_print ("invalidating due to deleting some text (%s)\n", G_STRLOC));
   _gtk_text_btree_invalidate_region (tree, start, end, FALSE);
 
+  tag_redisplay_text_changed (tree, start,
+                              gtk_text_iter_get_offset (end) -
+                              gtk_text_iter_get_offset (start), 0);
+
   /* Save the byte offset so we can reset the iterators */
   start_byte_offset = gtk_text_iter_get_line_index (start);
 
@@ -1172,19 +1203,41 @@ _gtk_text_btree_insert (GtkTextIter *iter,
       chunk_len = eol - sol;
 
       g_assert (g_utf8_validate (&text[sol], chunk_len, NULL));
-      seg = _gtk_char_segment_new (&text[sol], chunk_len);
-
-      char_count_delta += seg->char_count;
 
-      if (cur_seg == NULL)
-        {
-          seg->next = line->segments;
-          line->segments = seg;
-        }
-      else
+      /* Long lines are stored as several segments of limited size,
+       * keeping the paragraph delimiter in the last one.
+       */
+      while (TRUE)
         {
-          seg->next = cur_seg->next;
-          cur_seg->next = seg;
+          if (delim - sol > GTK_TEXT_CHAR_SEGMENT_MAX_BYTES)
+            {
+              chunk_len = GTK_TEXT_CHAR_SEGMENT_MAX_BYTES;
+              while ((text[sol + chunk_len] & 0xc0) == 0x80)
+                chunk_len--;
+            }
+          else
+            chunk_len = eol - sol;
+
+          seg = _gtk_char_segment_new (&text[sol], chunk_len);
+
+          char_count_delta += seg->char_count;
+
+          if (cur_seg == NULL)
+            {
+              seg->next = line->segments;
+              line->segments = seg;
+            }
+          else
+            {
+              seg->next = cur_seg->next;
+              cur_seg->next = seg;
+            }
+
+          sol += chunk_len;
+          if (sol == eol)
+            break;
+
+          cur_seg = seg;
         }
 
       if (delim == eol)
@@ -1244,6 +1297,8 @@ _gtk_text_btree_insert (GtkTextIter *iter,
     DV (g_print ("invalidating due to inserting some text (%s)\n", G_STRLOC));
     _gtk_text_btree_invalidate_region (tree, &start, &end, FALSE);
 
+    tag_redisplay_text_changed (tree, &start, 0, char_count_delta);
+
 
     /* Convenience for the user */
     *iter = end;
@@ -1293,6 +1348,8 @@ insert_pixbuf_or_widget_segment (GtkTextIter        *iter,
 
   DV (g_print ("invalidating due to inserting pixbuf/widget (%s)\n", G_STRLOC));
   _gtk_text_btree_invalidate_region (tree, &start, iter, FALSE);
+
+  tag_redisplay_text_changed (tree, &start, 0, seg->char_count);
 }
      
 void
@@ -1735,12 +1792,105 @@ iter_stack_invert (IterStack *stack)
     }
 }
 
+/* Adds the range from @start to @end to @ranges, merging it with the
+ * ranges it overlaps or touches.
+ */
+static void
+add_to_ranges (GArray            *ranges,
+               const GtkTextIter *start,
+               const GtkTextIter *end)
+{
+  TagRedisplayRange range;
+  guint first, last, lo, hi;
+
+  range.start = gtk_text_iter_get_offset (start);
+  range.end = gtk_text_iter_get_offset (end);
+
+  /* Find the first range that ends at or after the new one starts */
+  lo = 0;
+  hi = ranges->len;
+  while (lo < hi)
+    {
+      guint mid = (lo + hi) / 2;
+
+      if (g_array_index (ranges, TagRedisplayRange, mid).end < range.start)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+  first = lo;
+
+  for (last = first; last < ranges->len; last++)
+    {
+      TagRedisplayRange *r = &g_array_index (ranges, TagRedisplayRange, last);
+
+      if (r->start > range.end)
+        break;
+
+      range.start = MIN (range.start, r->start);
+      range.end = MAX (range.end, r->end);
+    }
+
+  if (last > first)
+    g_array_remove_range (ranges, first, last - first);
+  g_array_insert_val (ranges, first, range);
+}
+
+/* Moves the pending tag redisplay ranges along with an edit that
+ * replaced the characters from @offset to @offset + @n_deleted with
+ * @n_inserted new ones.
+ */
+static void
+adjust_ranges (GArray *ranges,
+               gint    offset,
+               gint    n_deleted,
+               gint    n_inserted)
+{
+  guint i;
+
+  for (i = 0; i < ranges->len; i++)
+    {
+      TagRedisplayRange *r = &g_array_index (ranges, TagRedisplayRange, i);
+
+      if (r->start > offset)
+        r->start = MAX (r->start - n_deleted, offset) + n_inserted;
+      if (r->end > offset)
+        r->end = MAX (r->end - n_deleted, offset) + n_inserted;
+    }
+}
+
+static void
+tag_redisplay_text_changed (GtkTextBTree      *tree,
+                            const GtkTextIter *start,
+                            gint               n_deleted,
+                            gint               n_inserted)
+{
+  gint offset;
+
+  if (tree->tag_invalidate_ranges->len == 0 &&
+      tree->tag_redisplay_ranges->len == 0)
+    return;
+
+  offset = gtk_text_iter_get_offset (start);
+  adjust_ranges (tree->tag_invalidate_ranges, offset, n_deleted, n_inserted);
+  adjust_ranges (tree->tag_redisplay_ranges, offset, n_deleted, n_inserted);
+}
+
 static void
 queue_tag_redisplay (GtkTextBTree      *tree,
                      GtkTextTag        *tag,
                      const GtkTextIter *start,
                      const GtkTextIter *end)
 {
+  if (tree->tag_redisplay_freeze_count > 0)
+    {
+      if (_gtk_text_tag_affects_size (tag))
+        add_to_ranges (tree->tag_invalidate_ranges, start, end);
+      else if (_gtk_text_tag_affects_nonsize_appearance (tag))
+        add_to_ranges (tree->tag_redisplay_ranges, start, end);
+      return;
+    }
+
   if (_gtk_text_tag_affects_size (tag))
     {
       DV (g_print ("invalidating due to size-affecting tag (%s)\n", G_STRLOC));
@@ -1755,6 +1905,57 @@ queue_tag_redisplay (GtkTextBTree      *tree,
   /* We don't need to do anything if the tag doesn't affect display */
 }
 
+/* Defers the relayout and redraw caused by applying or removing tags
+ * until the matching _gtk_text_btree_thaw_tag_redisplay(), so that a
+ * batch of tag changes only invalidates the views once.
+ */
+void
+_gtk_text_btree_freeze_tag_redisplay (GtkTextBTree *tree)
+{
+  tree->tag_redisplay_freeze_count++;
+}
+
+void
+_gtk_text_btree_thaw_tag_redisplay (GtkTextBTree *tree)
+{
+  GtkTextIter start, end;
+  gint char_count;
+  guint i;
+
+  g_return_if_fail (tree->tag_redisplay_freeze_count > 0);
+
+  tree->tag_redisplay_freeze_count--;
+  if (tree->tag_redisplay_freeze_count > 0)
+    return;
+
+  char_count = _gtk_text_btree_char_count (tree);
+
+  for (i = 0; i < tree->tag_invalidate_ranges->len; i++)
+    {
+      TagRedisplayRange *r = &g_array_index (tree->tag_invalidate_ranges,
+                                             TagRedisplayRange, i);
+
+      _gtk_text_btree_get_iter_at_char (tree, &start, MIN (r->start, char_count));
+      _gtk_text_btree_get_iter_at_char (tree, &end, MIN (r->end, char_count));
+
+      DV (g_print ("invalidating due to size-affecting tags (%s)\n", G_STRLOC));
+      _gtk_text_btree_invalidate_region (tree, &start, &end, FALSE);
+    }
+  g_array_set_size (tree->tag_invalidate_ranges, 0);
+
+  for (i = 0; i < tree->tag_redisplay_ranges->len; i++)
+    {
+      TagRedisplayRange *r = &g_array_index (tree->tag_redisplay_ranges,
+                                             TagRedisplayRange, i);
+
+      _gtk_text_btree_get_iter_at_char (tree, &start, MIN (r->start, char_count));
+      _gtk_text_btree_get_iter_at_char (tree, &end, MIN (r->end, char_count));
+
+      redisplay_region (tree, &start, &end, FALSE);
+    }
+  g_array_set_size (tree->tag_redisplay_ranges, 0);
+}
+
 void
 _gtk_text_btree_tag (const GtkTextIter *start_orig,
                      const GtkTextIter *end_orig,
@@ -116,6 +116,8 @@ void _gtk_text_btree_tag (const GtkTextIter *start,
                           const GtkTextIter *end,
                           GtkTextTag        *tag,
                           gboolean           apply);
+void _gtk_text_btree_freeze_tag_redisplay (GtkTextBTree *tree);
+void _gtk_text_btree_thaw_tag_redisplay   (GtkTextBTree *tree);
 
 /* "Getters" */
 
@@ -947,6 +947,311 @@ gtk_text_buffer_insert_at_cursor (GtkTextBuffer *buffer,
   gtk_text_buffer_insert (buffer, &iter, text, len);
 }
 
+#define INSERT_STREAM_CHUNK_SIZE 262144
+
+typedef struct
+{
+  GtkTextBuffer *buffer;
+  GtkTextMark *mark;
+  GInputStream *stream;
+  GCancellable *cancellable;
+  GFileProgressCallback progress_callback;
+  gpointer progress_data;
+  GSimpleAsyncResult *result;
+  gint io_priority;
+
+  /* Set when the text around the insertion point is deleted */
+  gulong delete_range_id;
+  gboolean displaced;
+
+  /* Room for one chunk plus the bytes held back from the previous one */
+  gchar *data;
+  gsize n_held;
+
+  goffset n_read;
+  goffset total;
+} InsertStreamData;
+
+static void insert_stream_read (InsertStreamData *data);
+
+static void
+insert_stream_data_free (InsertStreamData *data)
+{
+  g_signal_handler_disconnect (data->buffer, data->delete_range_id);
+  if (!gtk_text_mark_get_deleted (data->mark))
+    gtk_text_buffer_delete_mark (data->buffer, data->mark);
+  g_object_unref (data->mark);
+  g_object_unref (data->buffer);
+  g_object_unref (data->stream);
+  if (data->cancellable)
+    g_object_unref (data->cancellable);
+  g_object_unref (data->result);
+  g_free (data->data);
+  g_slice_free (InsertStreamData, data);
+}
+
+static void
+insert_stream_complete (InsertStreamData *data,
+                        GError           *error)
+{
+  if (error)
+    {
+      g_simple_async_result_set_from_error (data->result, error);
+      g_error_free (error);
+    }
+  else
+    g_simple_async_result_set_op_res_gboolean (data->result, TRUE);
+
+  g_simple_async_result_complete (data->result);
+  insert_stream_data_free (data);
+}
+
+/* Deleting a range that the insertion point is strictly inside of
+ * moves it to the start of the range, somewhere the rest of the stream
+ * doesn't belong.
+ */
+static void
+insert_stream_delete_range (GtkTextBuffer    *buffer,
+                            GtkTextIter      *start,
+                            GtkTextIter      *end,
+                            InsertStreamData *data)
+{
+  GtkTextIter iter;
+
+  if (gtk_text_mark_get_deleted (data->mark))
+    return;
+
+  gtk_text_buffer_get_iter_at_mark (buffer, &iter, data->mark);
+  if (gtk_text_iter_compare (start, &iter) < 0 &&
+      gtk_text_iter_compare (&iter, end) < 0)
+    data->displaced = TRUE;
+}
+
+/* Inserts the first @len bytes of the chunk buffer at the insertion
+ * mark. The text has been validated already, so the signal is emitted
+ * directly rather than through gtk_text_buffer_insert(), which would
+ * validate it once more.
+ */
+static void
+insert_stream_insert (InsertStreamData *data,
+                      gsize             len)
+{
+  GtkTextIter iter;
+
+  if (len == 0)
+    return;
+
+  gtk_text_buffer_get_iter_at_mark (data->buffer, &iter, data->mark);
+  g_signal_emit (data->buffer, signals[INSERT_TEXT], 0,
+                 &iter, data->data, (gint) len);
+}
+
+static void
+insert_stream_read_cb (GObject      *source,
+                       GAsyncResult *result,
+                       gpointer      user_data)
+{
+  InsertStreamData *data = user_data;
+  GError *error = NULL;
+  const gchar *end;
+  gssize n_read;
+  gsize len, valid;
+
+  GDK_THREADS_ENTER ();
+
+  n_read = g_input_stream_read_finish (data->stream, result, &error);
+  if (n_read < 0)
+    {
+      insert_stream_complete (data, error);
+      goto out;
+    }
+
+  if (data->displaced || gtk_text_mark_get_deleted (data->mark))
+    {
+      g_set_error_literal (&error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                           _("The text at the insertion point was removed"));
+      insert_stream_complete (data, error);
+      goto out;
+    }
+
+  len = data->n_held + n_read;
+
+  if (!g_utf8_validate (data->data, len, &end))
+    {
+      gsize rest = len - (end - data->data);
+
+      /* A character cut in half by the end of this chunk is fine,
+       * it gets completed by the next one.
+       */
+      if (n_read == 0 || rest >= 4 ||
+          g_utf8_get_char_validated (end, rest) != (gunichar)-2)
+        {
+          g_set_error_literal (&error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+                               _("Invalid UTF-8 data encountered"));
+          insert_stream_complete (data, error);
+          goto out;
+        }
+    }
+  valid = end - data->data;
+
+  /* Hold back a trailing \r, so that a \r\n pair split between two
+   * chunks ends up as one line break.
+   */
+  if (n_read > 0 && valid > 0 && data->data[valid - 1] == '\r')
+    valid--;
+
+  insert_stream_insert (data, valid);
+
+  data->n_held = len - valid;
+  g_memmove (data->data, data->data + valid, data->n_held);
+  data->n_read += n_read;
+
+  if (n_read == 0)
+    {
+      insert_stream_complete (data, NULL);
+      goto out;
+    }
+
+  if (data->progress_callback)
+    data->progress_callback (data->n_read, data->total, data->progress_data);
+
+  insert_stream_read (data);
+
+ out:
+  GDK_THREADS_LEAVE ();
+}
+
+static void
+insert_stream_read (InsertStreamData *data)
+{
+  g_input_stream_read_async (data->stream,
+                             data->data + data->n_held,
+                             INSERT_STREAM_CHUNK_SIZE,
+                             data->io_priority,
+                             data->cancellable,
+                             insert_stream_read_cb,
+                             data);
+}
+
+/**
+ * gtk_text_buffer_insert_stream_async:
+ * @buffer: a #GtkTextBuffer
+ * @iter: a position in @buffer
+ * @stream: a #GInputStream to read UTF-8 text from
+ * @io_priority: the I/O priority of the reads
+ * @cancellable: optional #GCancellable object, %NULL to ignore
+ * @progress_callback: function to call with the number of bytes read
+ *   so far, or %NULL
+ * @progress_data: user data to pass to @progress_callback
+ * @callback: a #GAsyncReadyCallback to call when the stream is
+ *   exhausted or an error occurs
+ * @user_data: user data to pass to @callback
+ *
+ * Reads the contents of @stream asynchronously and inserts them into
+ * @buffer at @iter. Text is validated and inserted in chunks as it
+ * arrives, so a large file can be loaded without holding all of it in
+ * memory at once and without blocking the main loop. Each chunk is
+ * inserted with a separate emission of the #GtkTextBuffer::insert-text
+ * signal, and following chunks go after the text inserted so far, even
+ * if the buffer is modified in between. If the text around that
+ * position is deleted, or the buffer otherwise loses track of it,
+ * loading stops with a %G_IO_ERROR_FAILED error.
+ *
+ * When the whole stream has been read, or reading fails, @callback is
+ * called and should call gtk_text_buffer_insert_stream_finish() to
+ * get the result. Text that was inserted before an error stays in the
+ * buffer.
+ *
+ * If @stream is a #GFileInputStream, the total size passed to
+ * @progress_callback is the size of the file, otherwise it is -1.
+ *
+ * Since: 2.18
+ **/
+void
+gtk_text_buffer_insert_stream_async (GtkTextBuffer         *buffer,
+                                     GtkTextIter           *iter,
+                                     GInputStream          *stream,
+                                     gint                   io_priority,
+                                     GCancellable          *cancellable,
+                                     GFileProgressCallback  progress_callback,
+                                     gpointer               progress_data,
+                                     GAsyncReadyCallback    callback,
+                                     gpointer               user_data)
+{
+  InsertStreamData *data;
+
+  g_return_if_fail (GTK_IS_TEXT_BUFFER (buffer));
+  g_return_if_fail (iter != NULL);
+  g_return_if_fail (gtk_text_iter_get_buffer (iter) == buffer);
+  g_return_if_fail (G_IS_INPUT_STREAM (stream));
+
+  data = g_slice_new0 (InsertStreamData);
+  data->buffer = g_object_ref (buffer);
+  /* Right gravity, so that the mark stays after the text inserted so far */
+  data->mark = g_object_ref (gtk_text_buffer_create_mark (buffer, NULL, iter, FALSE));
+  data->stream = g_object_ref (stream);
+  data->cancellable = cancellable ? g_object_ref (cancellable) : NULL;
+  data->progress_callback = progress_callback;
+  data->progress_data = progress_data;
+  data->io_priority = io_priority;
+  data->result = g_simple_async_result_new (G_OBJECT (buffer),
+                                            callback, user_data,
+                                            gtk_text_buffer_insert_stream_async);
+  /* Up to 3 bytes of an incomplete character are held back */
+  data->data = g_malloc (INSERT_STREAM_CHUNK_SIZE + 4);
+  data->total = -1;
+  data->delete_range_id =
+    g_signal_connect (buffer, "delete-range",
+                      G_CALLBACK (insert_stream_delete_range), data);
+
+  if (G_IS_FILE_INPUT_STREAM (stream))
+    {
+      GFileInfo *info;
+
+      info = g_file_input_stream_query_info (G_FILE_INPUT_STREAM (stream),
+                                             G_FILE_ATTRIBUTE_STANDARD_SIZE,
+                                             cancellable, NULL);
+      if (info)
+        {
+          data->total = g_file_info_get_size (info);
+          g_object_unref (info);
+        }
+    }
+
+  insert_stream_read (data);
+}
+
+/**
+ * gtk_text_buffer_insert_stream_finish:
+ * @buffer: a #GtkTextBuffer
+ * @result: a #GAsyncResult
+ * @error: return location for an error, or %NULL
+ *
+ * Finishes an operation started with gtk_text_buffer_insert_stream_async().
+ *
+ * Return value: %TRUE if the whole stream was inserted, %FALSE if an
+ *   error occurred
+ *
+ * Since: 2.18
+ **/
+gboolean
+gtk_text_buffer_insert_stream_finish (GtkTextBuffer  *buffer,
+                                      GAsyncResult   *result,
+                                      GError        **error)
+{
+  GSimpleAsyncResult *simple;
+
+  g_return_val_if_fail (GTK_IS_TEXT_BUFFER (buffer), FALSE);
+  g_return_val_if_fail (G_IS_SIMPLE_ASYNC_RESULT (result), FALSE);
+
+  simple = G_SIMPLE_ASYNC_RESULT (result);
+
+  if (g_simple_async_result_propagate_error (simple, error))
+    return FALSE;
+
+  return g_simple_async_result_get_op_res_gboolean (simple);
+}
+
 /**
  * gtk_text_buffer_insert_interactive:
  * @buffer: a #GtkTextBuffer
@@ -2805,7 +3110,10 @@ gtk_text_buffer_remove_all_tags (GtkTextBuffer     *buffer,
     }
 
   g_slist_foreach (tags, (GFunc) g_object_ref, NULL);
-  
+
+  /* All tags cover the same range, relayout it only once */
+  _gtk_text_btree_freeze_tag_redisplay (get_btree (buffer));
+
   tmp_list = tags;
   while (tmp_list != NULL)
     {
@@ -2816,11 +3124,115 @@ gtk_text_buffer_remove_all_tags (GtkTextBuffer     *buffer,
       tmp_list = tmp_list->next;
     }
 
+  _gtk_text_btree_thaw_tag_redisplay (get_btree (buffer));
+
   g_slist_foreach (tags, (GFunc) g_object_unref, NULL);
   
   g_slist_free (tags);
 }
 
+static gint
+tag_span_cmp (gconstpointer a,
+              gconstpointer b,
+              gpointer      user_data)
+{
+  const GtkTextTagSpan *span_a = a;
+  const GtkTextTagSpan *span_b = b;
+
+  if (span_a->tag != span_b->tag)
+    return pointer_cmp (span_a->tag, span_b->tag);
+  else if (span_a->start_offset < span_b->start_offset)
+    return -1;
+  else if (span_a->start_offset > span_b->start_offset)
+    return 1;
+  else
+    return 0;
+}
+
+/**
+ * gtk_text_buffer_apply_tag_spans:
+ * @buffer: a #GtkTextBuffer
+ * @spans: an array of #GtkTextTagSpan
+ * @n_spans: the number of elements in @spans
+ *
+ * Applies each tag in @spans to the range between its character
+ * offsets, as if gtk_text_buffer_apply_tag() had been called for
+ * each of them. This is much faster than applying the tags one by
+ * one when there are many of them, as is common for syntax
+ * highlighting: spans of the same tag that overlap or touch are
+ * merged first, so the "apply-tag" signal is emitted once per
+ * resulting range, and the affected text is only relaid out and
+ * redrawn once for the whole batch.
+ *
+ * The spans don't have to be sorted, and the start and end offset of
+ * a span don't have to be in order.
+ *
+ * Since: 2.18
+ **/
+void
+gtk_text_buffer_apply_tag_spans (GtkTextBuffer        *buffer,
+                                 const GtkTextTagSpan *spans,
+                                 gint                  n_spans)
+{
+  GtkTextTagSpan *sorted;
+  GtkTextIter start, end;
+  gint i, n_merged;
+
+  g_return_if_fail (GTK_IS_TEXT_BUFFER (buffer));
+  g_return_if_fail (spans != NULL || n_spans == 0);
+
+  if (n_spans <= 0)
+    return;
+
+  for (i = 0; i < n_spans; i++)
+    {
+      g_return_if_fail (GTK_IS_TEXT_TAG (spans[i].tag));
+      g_return_if_fail (spans[i].tag->table == buffer->tag_table);
+    }
+
+  sorted = g_new (GtkTextTagSpan, n_spans);
+  for (i = 0; i < n_spans; i++)
+    {
+      sorted[i].tag = spans[i].tag;
+      sorted[i].start_offset = MIN (spans[i].start_offset, spans[i].end_offset);
+      sorted[i].end_offset = MAX (spans[i].start_offset, spans[i].end_offset);
+    }
+
+  g_qsort_with_data (sorted, n_spans, sizeof (GtkTextTagSpan),
+                     tag_span_cmp, NULL);
+
+  /* Merge overlapping and adjacent spans of the same tag */
+  n_merged = 0;
+  for (i = 1; i < n_spans; i++)
+    {
+      GtkTextTagSpan *last = &sorted[n_merged];
+
+      if (sorted[i].tag == last->tag &&
+          sorted[i].start_offset <= last->end_offset)
+        last->end_offset = MAX (last->end_offset, sorted[i].end_offset);
+      else
+        sorted[++n_merged] = sorted[i];
+    }
+  n_merged++;
+
+  _gtk_text_btree_freeze_tag_redisplay (get_btree (buffer));
+
+  for (i = 0; i < n_merged; i++)
+    {
+      if (sorted[i].start_offset == sorted[i].end_offset)
+        continue;
+
+      gtk_text_buffer_get_iter_at_offset (buffer, &start, sorted[i].start_offset);
+      gtk_text_buffer_get_iter_at_offset (buffer, &end, sorted[i].end_offset);
+
+      gtk_text_buffer_emit_tag (buffer, sorted[i].tag, TRUE, &start, &end);
+    }
+
+  _gtk_text_btree_thaw_tag_redisplay (get_btree (buffer));
+
+  g_free (sorted);
+}
+
 
 /*
  * Obtain various iterators
@@ -31,6 +31,7 @@
 #ifndef __GTK_TEXT_BUFFER_H__
 #define __GTK_TEXT_BUFFER_H__
 
+#include <gio/gio.h>
 #include <gtk/gtkwidget.h>
 #include <gtk/gtkclipboard.h>
 #include <gtk/gtktexttagtable.h>
@@ -71,6 +72,26 @@ typedef struct _GtkTextLogAttrCache GtkTextLogAttrCache;
 
 typedef struct _GtkTextBufferClass GtkTextBufferClass;
 
+typedef struct _GtkTextTagSpan GtkTextTagSpan;
+
+/**
+ * GtkTextTagSpan:
+ * @tag: the #GtkTextTag to apply
+ * @start_offset: character offset of one end of the range
+ * @end_offset: character offset of the other end of the range
+ *
+ * A tag and the range of characters to apply it to, see
+ * gtk_text_buffer_apply_tag_spans().
+ *
+ * Since: 2.18
+ */
+struct _GtkTextTagSpan
+{
+  GtkTextTag *tag;
+  gint start_offset;
+  gint end_offset;
+};
+
 struct _GtkTextBuffer
 {
   GObject parent_instance;
@@ -180,6 +201,19 @@ void gtk_text_buffer_insert_at_cursor  (GtkTextBuffer *buffer,
                                         const gchar   *text,
                                         gint           len);
 
+void     gtk_text_buffer_insert_stream_async  (GtkTextBuffer         *buffer,
+                                               GtkTextIter           *iter,
+                                               GInputStream          *stream,
+                                               gint                   io_priority,
+                                               GCancellable          *cancellable,
+                                               GFileProgressCallback  progress_callback,
+                                               gpointer               progress_data,
+                                               GAsyncReadyCallback    callback,
+                                               gpointer               user_data);
+gboolean gtk_text_buffer_insert_stream_finish (GtkTextBuffer         *buffer,
+                                               GAsyncResult          *result,
+                                               GError               **error);
+
 gboolean gtk_text_buffer_insert_interactive           (GtkTextBuffer *buffer,
                                                        GtkTextIter   *iter,
                                                        const gchar   *text,
@@ -306,6 +340,9 @@ void gtk_text_buffer_remove_tag_by_name    (GtkTextBuffer     *buffer,
 void gtk_text_buffer_remove_all_tags       (GtkTextBuffer     *buffer,
                                             const GtkTextIter *start,
                                             const GtkTextIter *end);
+void gtk_text_buffer_apply_tag_spans       (GtkTextBuffer        *buffer,
+                                            const GtkTextTagSpan *spans,
+                                            gint                  n_spans);
 
 
 /* You can either ignore the return value, or use it to
@@ -456,6 +456,168 @@ gtk_text_buffer_get_deserialize_formats (GtkTextBuffer *buffer,
   return get_formats (formats, n_formats);
 }
 
+/*  Deserializes either @data or, for GTK+'s internal format only,
+ *  @stream into @content_buffer at @iter
+ */
+static gboolean
+deserialize_with_format (GtkTextBuffer     *register_buffer,
+                         GtkTextBuffer     *content_buffer,
+                         GtkRichTextFormat *fmt,
+                         GtkTextIter       *iter,
+                         const guint8      *data,
+                         gsize              length,
+                         GInputStream      *stream,
+                         GCancellable      *cancellable,
+                         GError           **error)
+{
+  GtkTextBufferDeserializeFunc function = fmt->function;
+  gboolean                     success;
+  GSList                      *split_tags;
+  GSList                      *list;
+  GtkTextMark                 *left_end        = NULL;
+  GtkTextMark                 *right_start     = NULL;
+  GSList                      *left_start_list = NULL;
+  GSList                      *right_end_list  = NULL;
+
+  /*  We don't want the tags that are effective at the insertion
+   *  point to affect the pasted text, therefore we remove and
+   *  remember them, so they can be re-applied left and right of
+   *  the inserted text after pasting
+   */
+  split_tags = gtk_text_iter_get_tags (iter);
+
+  list = split_tags;
+  while (list)
+    {
+      GtkTextTag *tag = list->data;
+
+      list = g_slist_next (list);
+
+      /*  If a tag begins at the insertion point, ignore it
+       *  because it doesn't affect the pasted text
+       */
+      if (gtk_text_iter_begins_tag (iter, tag))
+        split_tags = g_slist_remove (split_tags, tag);
+    }
+
+  if (split_tags)
+    {
+      /*  Need to remember text marks, because text iters
+       *  don't survive pasting
+       */
+      left_end = gtk_text_buffer_create_mark (content_buffer,
+                                              NULL, iter, TRUE);
+      right_start = gtk_text_buffer_create_mark (content_buffer,
+                                                 NULL, iter, FALSE);
+
+      for (list = split_tags; list; list = g_slist_next (list))
+        {
+          GtkTextTag  *tag             = list->data;
+          GtkTextIter *backward_toggle = gtk_text_iter_copy (iter);
+          GtkTextIter *forward_toggle  = gtk_text_iter_copy (iter);
+          GtkTextMark *left_start      = NULL;
+          GtkTextMark *right_end       = NULL;
+
+          gtk_text_iter_backward_to_tag_toggle (backward_toggle, tag);
+          left_start = gtk_text_buffer_create_mark (content_buffer,
+                                                    NULL,
+                                                    backward_toggle,
+                                                    FALSE);
+
+          gtk_text_iter_forward_to_tag_toggle (forward_toggle, tag);
+          right_end = gtk_text_buffer_create_mark (content_buffer,
+                                                   NULL,
+                                                   forward_toggle,
+                                                   TRUE);
+
+          left_start_list = g_slist_prepend (left_start_list, left_start);
+          right_end_list = g_slist_prepend (right_end_list, right_end);
+
+          gtk_text_buffer_remove_tag (content_buffer, tag,
+                                      backward_toggle,
+                                      forward_toggle);
+
+          gtk_text_iter_free (forward_toggle);
+          gtk_text_iter_free (backward_toggle);
+        }
+
+      left_start_list = g_slist_reverse (left_start_list);
+      right_end_list = g_slist_reverse (right_end_list);
+    }
+
+  if (stream)
+    success = _gtk_text_buffer_deserialize_rich_text_from_stream (register_buffer,
+                                                                  content_buffer,
+                                                                  iter, stream,
+                                                                  fmt->can_create_tags,
+                                                                  cancellable,
+                                                                  error);
+  else
+    success = function (register_buffer, content_buffer,
+                        iter, data, length,
+                        fmt->can_create_tags,
+                        fmt->user_data,
+                        error);
+
+  if (!success && error != NULL && *error == NULL)
+    g_set_error (error, 0, 0,
+                 _("Unknown error when trying to deserialize %s"),
+                 gdk_atom_name (fmt->atom));
+
+  if (split_tags)
+    {
+      GSList      *left_list;
+      GSList      *right_list;
+      GtkTextIter  left_e;
+      GtkTextIter  right_s;
+
+      /*  Turn the remembered marks back into iters so they
+       *  can by used to re-apply the remembered tags
+       */
+      gtk_text_buffer_get_iter_at_mark (content_buffer,
+                                        &left_e, left_end);
+      gtk_text_buffer_get_iter_at_mark (content_buffer,
+                                        &right_s, right_start);
+
+      for (list = split_tags,
+             left_list = left_start_list,
+             right_list = right_end_list;
+           list && left_list && right_list;
+           list = g_slist_next (list),
+             left_list = g_slist_next (left_list),
+             right_list = g_slist_next (right_list))
+        {
+          GtkTextTag  *tag        = list->data;
+          GtkTextMark *left_start = left_list->data;
+          GtkTextMark *right_end  = right_list->data;
+          GtkTextIter  left_s;
+          GtkTextIter  right_e;
+
+          gtk_text_buffer_get_iter_at_mark (content_buffer,
+                                            &left_s, left_start);
+          gtk_text_buffer_get_iter_at_mark (content_buffer,
+                                            &right_e, right_end);
+
+          gtk_text_buffer_apply_tag (content_buffer, tag,
+                                     &left_s, &left_e);
+          gtk_text_buffer_apply_tag (content_buffer, tag,
+                                     &right_s, &right_e);
+
+          gtk_text_buffer_delete_mark (content_buffer, left_start);
+          gtk_text_buffer_delete_mark (content_buffer, right_end);
+        }
+
+      gtk_text_buffer_delete_mark (content_buffer, left_end);
+      gtk_text_buffer_delete_mark (content_buffer, right_start);
+
+      g_slist_free (split_tags);
+      g_slist_free (left_start_list);
+      g_slist_free (right_end_list);
+    }
+
+  return success;
+}
+
 /**
  * gtk_text_buffer_serialize:
  * @register_buffer: the #GtkTextBuffer @format is registered with
@@ -564,144 +726,183 @@ gtk_text_buffer_deserialize (GtkTextBuffer  *register_buffer,
       GtkRichTextFormat *fmt = list->data;
 
       if (fmt->atom == format)
-        {
-          GtkTextBufferDeserializeFunc function = fmt->function;
-          gboolean                     success;
-          GSList                      *split_tags;
-          GSList                      *list;
-          GtkTextMark                 *left_end        = NULL;
-          GtkTextMark                 *right_start     = NULL;
-          GSList                      *left_start_list = NULL;
-          GSList                      *right_end_list  = NULL;
-
-          /*  We don't want the tags that are effective at the insertion
-           *  point to affect the pasted text, therefore we remove and
-           *  remember them, so they can be re-applied left and right of
-           *  the inserted text after pasting
-           */
-          split_tags = gtk_text_iter_get_tags (iter);
-
-          list = split_tags;
-          while (list)
-            {
-              GtkTextTag *tag = list->data;
+        return deserialize_with_format (register_buffer, content_buffer,
+                                        fmt, iter, data, length, NULL, NULL,
+                                        error);
+    }
 
-              list = g_slist_next (list);
+  g_set_error (error, 0, 0,
+               _("No deserialize function found for format %s"),
+               gdk_atom_name (format));
 
-              /*  If a tag begins at the insertion point, ignore it
-               *  because it doesn't affect the pasted text
-               */
-              if (gtk_text_iter_begins_tag (iter, tag))
-                split_tags = g_slist_remove (split_tags, tag);
-            }
+  return FALSE;
+}
 
-          if (split_tags)
-            {
-              /*  Need to remember text marks, because text iters
-               *  don't survive pasting
-               */
-              left_end = gtk_text_buffer_create_mark (content_buffer,
-                                                      NULL, iter, TRUE);
-              right_start = gtk_text_buffer_create_mark (content_buffer,
-                                                         NULL, iter, FALSE);
-
-              for (list = split_tags; list; list = g_slist_next (list))
-                {
-                  GtkTextTag  *tag             = list->data;
-                  GtkTextIter *backward_toggle = gtk_text_iter_copy (iter);
-                  GtkTextIter *forward_toggle  = gtk_text_iter_copy (iter);
-                  GtkTextMark *left_start      = NULL;
-                  GtkTextMark *right_end       = NULL;
-
-                  gtk_text_iter_backward_to_tag_toggle (backward_toggle, tag);
-                  left_start = gtk_text_buffer_create_mark (content_buffer,
-                                                            NULL,
-                                                            backward_toggle,
-                                                            FALSE);
-
-                  gtk_text_iter_forward_to_tag_toggle (forward_toggle, tag);
-                  right_end = gtk_text_buffer_create_mark (content_buffer,
-                                                           NULL,
-                                                           forward_toggle,
-                                                           TRUE);
-
-                  left_start_list = g_slist_prepend (left_start_list, left_start);
-                  right_end_list = g_slist_prepend (right_end_list, right_end);
-
-                  gtk_text_buffer_remove_tag (content_buffer, tag,
-                                              backward_toggle,
-                                              forward_toggle);
-
-                  gtk_text_iter_free (forward_toggle);
-                  gtk_text_iter_free (backward_toggle);
-                }
-
-              left_start_list = g_slist_reverse (left_start_list);
-              right_end_list = g_slist_reverse (right_end_list);
-            }
 
-          success = function (register_buffer, content_buffer,
-                              iter, data, length,
-                              fmt->can_create_tags,
-                              fmt->user_data,
-                              error);
+/**
+ * gtk_text_buffer_serialize_to_stream:
+ * @register_buffer: the #GtkTextBuffer @format is registered with
+ * @content_buffer: the #GtkTextBuffer to serialize
+ * @format: the rich text format to use for serializing
+ * @start: start of block of text to serialize
+ * @end: end of block of test to serialize
+ * @stream: a #GOutputStream to write the serialized data to
+ * @cancellable: optional #GCancellable object, %NULL to ignore
+ * @error: return location for a #GError
+ *
+ * Like gtk_text_buffer_serialize(), but writes the serialized data
+ * to @stream. GTK+'s internal rich text format is written in pieces
+ * of bounded size as the buffer contents are serialized, so large
+ * buffers can be saved without building the whole document in
+ * memory. Other formats are serialized in memory and then written.
+ *
+ * Return value: %TRUE on success, %FALSE otherwise.
+ *
+ * Since: 2.18
+ **/
+gboolean
+gtk_text_buffer_serialize_to_stream (GtkTextBuffer     *register_buffer,
+                                     GtkTextBuffer     *content_buffer,
+                                     GdkAtom            format,
+                                     const GtkTextIter *start,
+                                     const GtkTextIter *end,
+                                     GOutputStream     *stream,
+                                     GCancellable      *cancellable,
+                                     GError           **error)
+{
+  GList *formats;
+  GList *list;
+
+  g_return_val_if_fail (GTK_IS_TEXT_BUFFER (register_buffer), FALSE);
+  g_return_val_if_fail (GTK_IS_TEXT_BUFFER (content_buffer), FALSE);
+  g_return_val_if_fail (format != GDK_NONE, FALSE);
+  g_return_val_if_fail (start != NULL, FALSE);
+  g_return_val_if_fail (end != NULL, FALSE);
+  g_return_val_if_fail (G_IS_OUTPUT_STREAM (stream), FALSE);
+  g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+  formats = g_object_get_qdata (G_OBJECT (register_buffer),
+                                serialize_quark ());
 
-          if (!success && error != NULL && *error == NULL)
-            g_set_error (error, 0, 0,
-                         _("Unknown error when trying to deserialize %s"),
-                         gdk_atom_name (format));
+  for (list = formats; list; list = g_list_next (list))
+    {
+      GtkRichTextFormat *fmt = list->data;
 
-          if (split_tags)
+      if (fmt->atom == format)
+        {
+          GtkTextBufferSerializeFunc function = fmt->function;
+          guint8                    *data;
+          gsize                      length;
+          gboolean                   success;
+
+          if (function == _gtk_text_buffer_serialize_rich_text)
+            return _gtk_text_buffer_serialize_rich_text_to_stream (register_buffer,
+                                                                   content_buffer,
+                                                                   start, end,
+                                                                   stream,
+                                                                   cancellable,
+                                                                   error);
+
+          data = function (register_buffer, content_buffer,
+                           start, end, &length, fmt->user_data);
+
+          if (!data)
             {
-              GSList      *left_list;
-              GSList      *right_list;
-              GtkTextIter  left_e;
-              GtkTextIter  right_s;
-
-              /*  Turn the remembered marks back into iters so they
-               *  can by used to re-apply the remembered tags
-               */
-              gtk_text_buffer_get_iter_at_mark (content_buffer,
-                                                &left_e, left_end);
-              gtk_text_buffer_get_iter_at_mark (content_buffer,
-                                                &right_s, right_start);
-
-              for (list = split_tags,
-                     left_list = left_start_list,
-                     right_list = right_end_list;
-                   list && left_list && right_list;
-                   list = g_slist_next (list),
-                     left_list = g_slist_next (left_list),
-                     right_list = g_slist_next (right_list))
-                {
-                  GtkTextTag  *tag        = list->data;
-                  GtkTextMark *left_start = left_list->data;
-                  GtkTextMark *right_end  = right_list->data;
-                  GtkTextIter  left_s;
-                  GtkTextIter  right_e;
-
-                  gtk_text_buffer_get_iter_at_mark (content_buffer,
-                                                    &left_s, left_start);
-                  gtk_text_buffer_get_iter_at_mark (content_buffer,
-                                                    &right_e, right_end);
-
-                  gtk_text_buffer_apply_tag (content_buffer, tag,
-                                             &left_s, &left_e);
-                  gtk_text_buffer_apply_tag (content_buffer, tag,
-                                             &right_s, &right_e);
-
-                  gtk_text_buffer_delete_mark (content_buffer, left_start);
-                  gtk_text_buffer_delete_mark (content_buffer, right_end);
-                }
-
-              gtk_text_buffer_delete_mark (content_buffer, left_end);
-              gtk_text_buffer_delete_mark (content_buffer, right_start);
-
-              g_slist_free (split_tags);
-              g_slist_free (left_start_list);
-              g_slist_free (right_end_list);
+              g_set_error (error, 0, 0,
+                           _("Unknown error when trying to serialize %s"),
+                           gdk_atom_name (format));
+              return FALSE;
             }
 
+          success = g_output_stream_write_all (stream, data, length, NULL,
+                                               cancellable, error);
+          g_free (data);
+
+          return success;
+        }
+    }
+
+  g_set_error (error, 0, 0,
+               _("No serialize function found for format %s"),
+               gdk_atom_name (format));
+
+  return FALSE;
+}
+
+/**
+ * gtk_text_buffer_deserialize_from_stream:
+ * @register_buffer: the #GtkTextBuffer @format is registered with
+ * @content_buffer: the #GtkTextBuffer to deserialize into
+ * @format: the rich text format to use for deserializing
+ * @iter: insertion point for the deserialized text
+ * @stream: a #GInputStream to read the serialized data from
+ * @cancellable: optional #GCancellable object, %NULL to ignore
+ * @error: return location for a #GError
+ *
+ * Like gtk_text_buffer_deserialize(), but reads the data to
+ * deserialize from @stream. GTK+'s internal rich text format is
+ * parsed in pieces of bounded size and inserted as it is read;
+ * if an error occurs, the text inserted up to that point is
+ * left in @content_buffer. Other formats are read into memory
+ * completely before they are deserialized.
+ *
+ * Return value: %TRUE on success, %FALSE otherwise.
+ *
+ * Since: 2.18
+ **/
+gboolean
+gtk_text_buffer_deserialize_from_stream (GtkTextBuffer  *register_buffer,
+                                         GtkTextBuffer  *content_buffer,
+                                         GdkAtom         format,
+                                         GtkTextIter    *iter,
+                                         GInputStream   *stream,
+                                         GCancellable   *cancellable,
+                                         GError        **error)
+{
+  GList    *formats;
+  GList    *list;
+
+  g_return_val_if_fail (GTK_IS_TEXT_BUFFER (register_buffer), FALSE);
+  g_return_val_if_fail (GTK_IS_TEXT_BUFFER (content_buffer), FALSE);
+  g_return_val_if_fail (format != GDK_NONE, FALSE);
+  g_return_val_if_fail (iter != NULL, FALSE);
+  g_return_val_if_fail (G_IS_INPUT_STREAM (stream), FALSE);
+  g_return_val_if_fail (error == NULL || *error == NULL, FALSE);
+
+  formats = g_object_get_qdata (G_OBJECT (register_buffer),
+                                deserialize_quark ());
+
+  for (list = formats; list; list = g_list_next (list))
+    {
+      GtkRichTextFormat *fmt = list->data;
+
+      if (fmt->atom == format)
+        {
+          GByteArray *data;
+          guint8      buffer[8192];
+          gssize      bytes_read;
+          gboolean    success;
+
+          if (fmt->function == _gtk_text_buffer_deserialize_rich_text)
+            return deserialize_with_format (register_buffer, content_buffer,
+                                            fmt, iter, NULL, 0,
+                                            stream, cancellable, error);
+
+          data = g_byte_array_new ();
+
+          while ((bytes_read = g_input_stream_read (stream, buffer, sizeof (buffer),
+                                                    cancellable, error)) > 0)
+            g_byte_array_append (data, buffer, bytes_read);
+
+          if (bytes_read < 0)
+            success = FALSE;
+          else
+            success = deserialize_with_format (register_buffer, content_buffer,
+                                               fmt, iter, data->data, data->len,
+                                               NULL, NULL, error);
+
+          g_byte_array_free (data, TRUE);
+
           return success;
         }
     }
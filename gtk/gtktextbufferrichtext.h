@@ -91,6 +91,22 @@ gboolean  gtk_text_buffer_deserialize                 (GtkTextBuffer
                                                        gsize                         length,
                                                        GError                      **error);
 
+gboolean  gtk_text_buffer_serialize_to_stream         (GtkTextBuffer                *register_buffer,
+                                                       GtkTextBuffer                *content_buffer,
+                                                       GdkAtom                       format,
+                                                       const GtkTextIter            *start,
+                                                       const GtkTextIter            *end,
+                                                       GOutputStream                *stream,
+                                                       GCancellable                 *cancellable,
+                                                       GError                      **error);
+gboolean  gtk_text_buffer_deserialize_from_stream     (GtkTextBuffer                *register_buffer,
+                                                       GtkTextBuffer                *content_buffer,
+                                                       GdkAtom                       format,
+                                                       GtkTextIter                  *iter,
+                                                       GInputStream                 *stream,
+                                                       GCancellable                 *cancellable,
+                                                       GError                      **error);
+
 G_END_DECLS
 
 #endif /* __GTK_TEXT_BUFFER_RICH_TEXT_H__ */
@@ -35,10 +35,20 @@
 #include "gtkalias.h"
 
 
+/* Output is written to streams in pieces of about this size, and
+ * text is copied out of the buffer in slices of at most this many
+ * characters.
+ */
+#define SERIALIZE_CHUNK_SIZE 65536
+#define SERIALIZE_SLICE_CHARS 4096
+
 typedef struct
 {
-  GString *tag_table_str;
-  GString *text_str;
+  GString *str;
+
+  /* The tags used in the range, mapped to the start tag that applies
+   * them, so names are escaped only once.
+   */
   GHashTable *tags;
   GtkTextIter start, end;
 
@@ -46,6 +56,16 @@ typedef struct
   GList *pixbufs;
   gint tag_id;
   GHashTable *tag_id_tags;
+
+  /* When serializing to a stream, @str is flushed to @stream whenever
+   * it grows past SERIALIZE_CHUNK_SIZE. If @measuring is set, it is
+   * only counted in @length instead.
+   */
+  GOutputStream *stream;
+  GCancellable *cancellable;
+  GError *error;
+  gboolean measuring;
+  gsize length;
 } SerializationContext;
 
 static gchar *
@@ -273,36 +293,110 @@ is_param_set (GObject    *object,
     }
 }
 
+static void
+flush_output (SerializationContext *context,
+              gboolean              force)
+{
+  if (context->stream == NULL && !context->measuring)
+    return;
+
+  if (context->str->len < SERIALIZE_CHUNK_SIZE && !force)
+    return;
+
+  if (context->measuring)
+    context->length += context->str->len;
+  else if (context->error == NULL)
+    g_output_stream_write_all (context->stream,
+                               context->str->str, context->str->len,
+                               NULL, context->cancellable,
+                               &context->error);
+
+  g_string_truncate (context->str, 0);
+}
+
+static void
+add_tag (SerializationContext *context,
+         GtkTextTag           *tag)
+{
+  gchar *tag_name;
+
+  if (g_hash_table_lookup (context->tags, tag))
+    return;
+
+  if (tag->name)
+    {
+      tag_name = g_markup_escape_text (tag->name, -1);
+      g_hash_table_insert (context->tags, tag,
+                           g_strdup_printf ("<apply_tag name=\"%s\">", tag_name));
+      g_free (tag_name);
+    }
+  else
+    {
+      gint tag_id = context->tag_id++;
+
+      g_hash_table_insert (context->tag_id_tags, tag, GINT_TO_POINTER (tag_id));
+      g_hash_table_insert (context->tags, tag,
+                           g_strdup_printf ("<apply_tag id=\"%d\">", tag_id));
+    }
+}
+
+/* Finds the tags used in the range, so that the tag table can be
+ * written before the text.
+ */
+static void
+collect_tags (SerializationContext *context)
+{
+  GtkTextIter iter;
+  GSList *tags, *l;
+
+  iter = context->start;
+  tags = gtk_text_iter_get_tags (&iter);
+
+  while (TRUE)
+    {
+      for (l = tags; l; l = l->next)
+        add_tag (context, l->data);
+
+      g_slist_free (tags);
+
+      if (!gtk_text_iter_forward_to_tag_toggle (&iter, NULL) ||
+          gtk_text_iter_compare (&iter, &context->end) >= 0)
+        break;
+
+      tags = gtk_text_iter_get_toggled_tags (&iter, TRUE);
+    }
+}
+
 static void
 serialize_tag (gpointer key,
                gpointer data,
                gpointer user_data)
 {
   SerializationContext *context = user_data;
-  GtkTextTag *tag = data;
+  GtkTextTag *tag = key;
   gchar *tag_name;
   gint tag_id;
   GParamSpec **pspecs;
   guint n_pspecs;
   int i;
 
-  g_string_append (context->tag_table_str, "  <tag ");
+  g_string_append (context->str, "  <tag ");
 
   /* Handle anonymous tags */
   if (tag->name)
     {
       tag_name = g_markup_escape_text (tag->name, -1);
-      g_string_append_printf (context->tag_table_str, "name=\"%s\"", tag_name);
+      g_string_append_printf (context->str, "name=\"%s\"", tag_name);
       g_free (tag_name);
     }
   else
     {
       tag_id = GPOINTER_TO_INT (g_hash_table_lookup (context->tag_id_tags, tag));
 
-      g_string_append_printf (context->tag_table_str, "id=\"%d\"", tag_id);
+      g_string_append_printf (context->str, "id=\"%d\"", tag_id);
     }
 
-  g_string_append_printf (context->tag_table_str, " priority=\"%d\">\n", tag->priority);
+  g_string_append_printf (context->str, " priority=\"%d\">\n", tag->priority);
 
   /* Serialize properties */
   pspecs = g_object_class_list_properties (G_OBJECT_GET_CLASS (tag), &n_pspecs);
@@ -325,11 +419,11 @@ serialize_tag (gpointer key,
       if (tmp2)
 	{
 	  tmp = g_markup_escape_text (pspecs[i]->name, -1);
-	  g_string_append_printf (context->tag_table_str, "   <attr name=\"%s\" ", tmp);
+	  g_string_append_printf (context->str, "   <attr name=\"%s\" ", tmp);
 	  g_free (tmp);
 
 	  tmp = g_markup_escape_text (g_type_name (pspecs[i]->value_type), -1);
-	  g_string_append_printf (context->tag_table_str, "type=\"%s\" value=\"%s\" />\n", tmp, tmp2);
+	  g_string_append_printf (context->str, "type=\"%s\" value=\"%s\" />\n", tmp, tmp2);
 
 	  g_free (tmp);
 	  g_free (tmp2);
@@ -340,16 +434,18 @@ serialize_tag (gpointer key,
 
   g_free (pspecs);
 
-  g_string_append (context->tag_table_str, "  </tag>\n");
+  g_string_append (context->str, "  </tag>\n");
+
+  flush_output (context, FALSE);
 }
 
 static void
 serialize_tags (SerializationContext *context)
 {
-  g_string_append (context->tag_table_str, " <text_view_markup>\n");
-  g_string_append (context->tag_table_str, " <tags>\n");
+  g_string_append (context->str, " <text_view_markup>\n");
+  g_string_append (context->str, " <tags>\n");
   g_hash_table_foreach (context->tags, serialize_tag, context);
-  g_string_append (context->tag_table_str, " </tags>\n");
+  g_string_append (context->str, " </tags>\n");
 }
 
 #if 0
@@ -435,8 +531,9 @@ serialize_text (GtkTextBuffer        *buffer,
   GtkTextIter iter, old_iter;
   GSList *tag_list, *new_tag_list;
   GSList *active_tags;
+  gint n_chars;
 
-  g_string_append (context->text_str, "<text>");
+  g_string_append (context->str, "<text>");
 
   iter = context->start;
   tag_list = NULL;
@@ -461,7 +558,7 @@ serialize_text (GtkTextBuffer        *buffer,
            */
           if (g_slist_find (active_tags, tag))
             {
-              g_string_append (context->text_str, "</apply_tag>");
+              g_string_append (context->str, "</apply_tag>");
 
               /* Drop all tags that were opened after this one (which are
                * above this on in the stack)
@@ -470,7 +567,7 @@ serialize_text (GtkTextBuffer        *buffer,
                 {
                   added = g_list_prepend (added, active_tags->data);
                   active_tags = g_slist_remove (active_tags, active_tags->data);
-                  g_string_append_printf (context->text_str, "</apply_tag>");
+                  g_string_append_printf (context->str, "</apply_tag>");
                 }
 
               active_tags = g_slist_remove (active_tags, active_tags->data);
@@ -481,33 +578,8 @@ serialize_text (GtkTextBuffer        *buffer,
       for (tmp = added; tmp; tmp = tmp->next)
 	{
 	  GtkTextTag *tag = tmp->data;
-	  gchar *tag_name;
-
-	  /* Add it to the tag hash table */
-	  g_hash_table_insert (context->tags, tag, tag);
-
-	  if (tag->name)
-	    {
-	      tag_name = g_markup_escape_text (tag->name, -1);
-
-	      g_string_append_printf (context->text_str, "<apply_tag name=\"%s\">", tag_name);
-	      g_free (tag_name);
-	    }
-	  else
-	    {
-	      gpointer tag_id;
-
-	      /* We've got an anonymous tag, find out if it's been
-		 used before */
-	      if (!g_hash_table_lookup_extended (context->tag_id_tags, tag, NULL, &tag_id))
-		{
-		  tag_id = GINT_TO_POINTER (context->tag_id++);
-
-		  g_hash_table_insert (context->tag_id_tags, tag, tag_id);
-		}
 
-	      g_string_append_printf (context->text_str, "<apply_tag id=\"%d\">", GPOINTER_TO_INT (tag_id));
-	    }
+	  g_string_append (context->str, g_hash_table_lookup (context->tags, tag));
 
 	  active_tags = g_slist_prepend (active_tags, tag);
 	}
@@ -519,6 +591,7 @@ serialize_text (GtkTextBuffer        *buffer,
       g_list_free (removed);
 
       old_iter = iter;
+      n_chars = 0;
 
       /* Now try to go to either the next tag toggle, or if a pixbuf appears */
       while (TRUE)
@@ -540,13 +613,15 @@ serialize_text (GtkTextBuffer        *buffer,
 		  gtk_text_iter_forward_char (&iter);
 		  old_iter = iter;
 
-		  g_string_append (context->text_str, escaped_text);
+		  g_string_append (context->str, escaped_text);
 		  g_free (escaped_text);
 
-		  g_string_append_printf (context->text_str, "<pixbuf index=\"%d\" />", context->n_pixbufs);
+		  g_string_append_printf (context->str, "<pixbuf index=\"%d\" />", context->n_pixbufs);
 
 		  context->n_pixbufs++;
 		  context->pixbufs = g_list_prepend (context->pixbufs, pixbuf);
+
+		  flush_output (context, FALSE);
 		}
 	    }
           else if (ch == 0)
@@ -558,6 +633,10 @@ serialize_text (GtkTextBuffer        *buffer,
 
 	  if (gtk_text_iter_toggles_tag (&iter, NULL))
 	    break;
+
+	  /* Don't copy out arbitrarily long runs of text at once */
+	  if (++n_chars >= SERIALIZE_SLICE_CHARS)
+	    break;
 	}
 
       /* We might have moved too far */
@@ -569,22 +648,23 @@ serialize_text (GtkTextBuffer        *buffer,
       escaped_text = g_markup_escape_text (tmp_text, -1);
       g_free (tmp_text);
 
-      g_string_append (context->text_str, escaped_text);
+      g_string_append (context->str, escaped_text);
       g_free (escaped_text);
+
+      flush_output (context, FALSE);
     }
   while (!gtk_text_iter_equal (&iter, &context->end));
 
   /* Close any open tags */
   for (tag_list = active_tags; tag_list; tag_list = tag_list->next)
-    g_string_append (context->text_str, "</apply_tag>");
+    g_string_append (context->str, "</apply_tag>");
 
   g_slist_free (active_tags);
-  g_string_append (context->text_str, "</text>\n</text_view_markup>\n");
+  g_string_append (context->str, "</text>\n</text_view_markup>\n");
 }
 
 static void
-serialize_pixbufs (SerializationContext *context,
-		   GString              *text)
+serialize_pixbufs (SerializationContext *context)
 {
   GList *list;
 
@@ -598,12 +678,48 @@ serialize_pixbufs (SerializationContext *context,
       gdk_pixdata_from_pixbuf (&pixdata, pixbuf, FALSE);
       tmp = gdk_pixdata_serialize (&pixdata, &len);
 
-      serialize_section_header (text, "GTKTEXTBUFFERPIXBDATA-0001", len);
-      g_string_append_len (text, (gchar *) tmp, len);
+      serialize_section_header (context->str, "GTKTEXTBUFFERPIXBDATA-0001", len);
+      g_string_append_len (context->str, (gchar *) tmp, len);
       g_free (tmp);
+
+      flush_output (context, FALSE);
     }
 }
 
+static void
+serialization_context_init (SerializationContext *context,
+                            const GtkTextIter    *start,
+                            const GtkTextIter    *end)
+{
+  context->str = g_string_new (NULL);
+  context->tags = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  context->start = *start;
+  context->end = *end;
+  context->n_pixbufs = 0;
+  context->pixbufs = NULL;
+  context->tag_id = 0;
+  context->tag_id_tags = g_hash_table_new (NULL, NULL);
+  context->stream = NULL;
+  context->cancellable = NULL;
+  context->error = NULL;
+  context->measuring = FALSE;
+  context->length = 0;
+
+  /* The tag table comes before the text, so find out first
+   * which tags are used */
+  collect_tags (context);
+}
+
+static void
+serialization_context_free (SerializationContext *context)
+{
+  g_hash_table_destroy (context->tags);
+  g_list_free (context->pixbufs);
+  if (context->str)
+    g_string_free (context->str, TRUE);
+  g_hash_table_destroy (context->tag_id_tags);
+}
+
 guint8 *
 _gtk_text_buffer_serialize_rich_text (GtkTextBuffer     *register_buffer,
                                       GtkTextBuffer     *content_buffer,
@@ -613,42 +729,86 @@ _gtk_text_buffer_serialize_rich_text (GtkTextBuffer     *register_buffer,
                                       gpointer           user_data)
 {
   SerializationContext context;
-  GString *text;
+  gint contents_length;
+  guchar *header;
+  gchar *text;
 
-  context.tags = g_hash_table_new (NULL, NULL);
-  context.text_str = g_string_new (NULL);
-  context.tag_table_str = g_string_new (NULL);
-  context.start = *start;
-  context.end = *end;
-  context.n_pixbufs = 0;
-  context.pixbufs = NULL;
-  context.tag_id = 0;
-  context.tag_id_tags = g_hash_table_new (NULL, NULL);
+  serialization_context_init (&context, start, end);
+
+  /* Write the header with a dummy length, and fill it in once we
+   * know the size of the contents */
+  serialize_section_header (context.str, "GTKTEXTBUFFERCONTENTS-0001", 0);
 
-  /* We need to serialize the text before the tag table so we know
-     what tags are used */
+  serialize_tags (&context);
   serialize_text (content_buffer, &context);
+
+  contents_length = context.str->len - 30;
+  header = (guchar *) context.str->str + 26;
+  header[0] = contents_length >> 24;
+  header[1] = (contents_length >> 16) & 0xff;
+  header[2] = (contents_length >> 8) & 0xff;
+  header[3] = contents_length & 0xff;
+
+  context.pixbufs = g_list_reverse (context.pixbufs);
+  serialize_pixbufs (&context);
+
+  *length = context.str->len;
+  text = g_string_free (context.str, FALSE);
+  context.str = NULL;
+
+  serialization_context_free (&context);
+
+  return (guint8 *) text;
+}
+
+gboolean
+_gtk_text_buffer_serialize_rich_text_to_stream (GtkTextBuffer     *register_buffer,
+                                                GtkTextBuffer     *content_buffer,
+                                                const GtkTextIter *start,
+                                                const GtkTextIter *end,
+                                                GOutputStream     *stream,
+                                                GCancellable      *cancellable,
+                                                GError           **error)
+{
+  SerializationContext context;
+  gboolean retval;
+
+  serialization_context_init (&context, start, end);
+
+  /* The contents section starts with its length, so go over it
+   * once without writing anything to find that out.
+   */
+  context.measuring = TRUE;
+
   serialize_tags (&context);
+  serialize_text (content_buffer, &context);
+  flush_output (&context, TRUE);
 
-  text = g_string_new (NULL);
-  serialize_section_header (text, "GTKTEXTBUFFERCONTENTS-0001",
-                            context.tag_table_str->len + context.text_str->len);
+  g_list_free (context.pixbufs);
+  context.pixbufs = NULL;
+  context.n_pixbufs = 0;
+
+  context.measuring = FALSE;
+  context.stream = stream;
+  context.cancellable = cancellable;
+
+  serialize_section_header (context.str, "GTKTEXTBUFFERCONTENTS-0001", context.length);
 
-  g_string_append_len (text, context.tag_table_str->str, context.tag_table_str->len);
-  g_string_append_len (text, context.text_str->str, context.text_str->len);
+  serialize_tags (&context);
+  serialize_text (content_buffer, &context);
 
   context.pixbufs = g_list_reverse (context.pixbufs);
-  serialize_pixbufs (&context, text);
+  serialize_pixbufs (&context);
 
-  g_hash_table_destroy (context.tags);
-  g_list_free (context.pixbufs);
-  g_string_free (context.text_str, TRUE);
-  g_string_free (context.tag_table_str, TRUE);
-  g_hash_table_destroy (context.tag_id_tags);
+  flush_output (&context, TRUE);
+
+  retval = context.error == NULL;
+  if (context.error)
+    g_propagate_error (error, context.error);
 
-  *length = text->len;
+  serialization_context_free (&context);
 
-  return (guint8 *) g_string_free (text, FALSE);
+  return retval;
 }
 
 typedef enum
@@ -713,8 +873,27 @@ typedef struct
 
   gboolean parsed_text;
   gboolean parsed_tags;
+
+  /* Tags resolved by name, so each name is only looked up once */
+  GHashTable *tag_cache;
+
+  /* When deserializing from a stream, text is inserted at @iter as
+   * soon as it is parsed instead of being collected in @spans. Pixbufs
+   * are stored after the text, so only their position is remembered
+   * in @pixbuf_marks until they are read.
+   */
+  GtkTextIter *iter;
+  GtkTextMark *insert_mark;
+  GPtrArray *pixbuf_marks;
 } ParseInfo;
 
+typedef struct
+{
+  gint index;
+  GtkTextMark *mark;
+  GSList *tags;
+} PixbufMark;
+
 static void
 set_error (GError              **err,
            GMarkupParseContext  *context,
@@ -992,7 +1171,7 @@ check_no_attributes (GMarkupParseContext  *context,
 }
 
 static GtkTextTag *
-tag_exists (GMarkupParseContext *context,
+lookup_tag (GMarkupParseContext *context,
 	    const gchar         *name,
 	    gint                 id,
 	    ParseInfo           *info,
@@ -1048,6 +1227,31 @@ tag_exists (GMarkupParseContext *context,
     }
 }
 
+static GtkTextTag *
+tag_exists (GMarkupParseContext *context,
+	    const gchar         *name,
+	    gint                 id,
+	    ParseInfo           *info,
+	    GError             **error)
+{
+  GtkTextTag *tag;
+
+  if (!name)
+    return lookup_tag (context, name, id, info, error);
+
+  tag = g_hash_table_lookup (info->tag_cache, name);
+
+  if (!tag)
+    {
+      tag = lookup_tag (context, name, id, info, error);
+
+      if (tag)
+        g_hash_table_insert (info->tag_cache, g_strdup (name), tag);
+    }
+
+  return tag;
+}
+
 typedef struct
 {
   const gchar *id;
@@ -1125,11 +1329,27 @@ parse_apply_tag_element (GMarkupParseContext  *context,
 	return;
 
       int_id = atoi (pixbuf_id);
+
+      if (info->iter)
+        {
+          PixbufMark *pixbuf_mark;
+
+          pixbuf_mark = g_new (PixbufMark, 1);
+          pixbuf_mark->index = int_id;
+          pixbuf_mark->mark = gtk_text_buffer_create_mark (info->buffer, NULL,
+                                                           info->iter, TRUE);
+          pixbuf_mark->tags = g_slist_copy (info->tag_stack);
+          g_ptr_array_add (info->pixbuf_marks, pixbuf_mark);
+
+          push_state (info, STATE_PIXBUF);
+          return;
+        }
+
       pixbuf = get_pixbuf_from_headers (info->headers, int_id, error);
 
       span = g_new0 (TextSpan, 1);
       span->pixbuf = pixbuf;
-      span->tags = NULL;
+      span->tags = g_slist_copy (info->tag_stack);
 
       info->spans = g_list_prepend (info->spans, span);
 
@@ -1553,6 +1773,40 @@ all_whitespace (const char *text,
   return TRUE;
 }
 
+/* Inserts @text or @pixbuf at @iter, which is moved to the end of
+ * the insertion, and applies @tags to it. info->insert_mark has to
+ * be at @iter.
+ */
+static void
+insert_span (ParseInfo   *info,
+             GtkTextIter *iter,
+             const gchar *text,
+             gint         len,
+             GdkPixbuf   *pixbuf,
+             GSList      *tags)
+{
+  GtkTextIter start_iter;
+
+  if (text)
+    gtk_text_buffer_insert (info->buffer, iter, text, len);
+  else
+    gtk_text_buffer_insert_pixbuf (info->buffer, iter, pixbuf);
+
+  gtk_text_buffer_get_iter_at_mark (info->buffer, &start_iter, info->insert_mark);
+
+  while (tags)
+    {
+      GtkTextTag *tag = tags->data;
+
+      gtk_text_buffer_apply_tag (info->buffer, tag,
+                                 &start_iter, iter);
+
+      tags = tags->next;
+    }
+
+  gtk_text_buffer_move_mark (info->buffer, info->insert_mark, iter);
+}
+
 static void
 text_handler (GMarkupParseContext  *context,
 	      const gchar          *text,
@@ -1578,6 +1832,12 @@ text_handler (GMarkupParseContext  *context,
       if (text_len == 0)
 	return;
 
+      if (info->iter)
+        {
+          insert_span (info, info->iter, text, text_len, NULL, info->tag_stack);
+          return;
+        }
+
       span = g_new0 (TextSpan, 1);
       span->text = g_strndup (text, text_len);
       span->tags = g_slist_copy (info->tag_stack);
@@ -1610,6 +1870,10 @@ parse_info_init (ParseInfo     *info,
   info->current_tag = NULL;
   info->current_tag_prio = -1;
   info->tag_priorities = NULL;
+  info->tag_cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, NULL);
+  info->iter = NULL;
+  info->insert_mark = NULL;
+  info->pixbuf_marks = NULL;
 
   info->buffer = buffer;
 }
@@ -1632,6 +1896,7 @@ parse_info_free (ParseInfo *info)
 
   g_hash_table_destroy (info->substitutions);
   g_hash_table_destroy (info->defined_tags);
+  g_hash_table_destroy (info->tag_cache);
 
   if (info->current_tag)
     g_object_unref (info->current_tag);
@@ -1664,48 +1929,26 @@ static void
 insert_text (ParseInfo   *info,
 	     GtkTextIter *iter)
 {
-  GtkTextIter start_iter;
-  GtkTextMark *mark;
   GList *tmp;
-  GSList *tags;
-
-  start_iter = *iter;
 
-  mark = gtk_text_buffer_create_mark (info->buffer, "deserialize_insert_point",
-  				      &start_iter, TRUE);
+  info->insert_mark = gtk_text_buffer_create_mark (info->buffer, "deserialize_insert_point",
+                                                   iter, TRUE);
 
   tmp = info->spans;
   while (tmp)
     {
       TextSpan *span = tmp->data;
 
-      if (span->text)
-	gtk_text_buffer_insert (info->buffer, iter, span->text, -1);
-      else
-	{
-	  gtk_text_buffer_insert_pixbuf (info->buffer, iter, span->pixbuf);
-	  g_object_unref (span->pixbuf);
-	}
-      gtk_text_buffer_get_iter_at_mark (info->buffer, &start_iter, mark);
-
-      /* Apply tags */
-      tags = span->tags;
-      while (tags)
-	{
-	  GtkTextTag *tag = tags->data;
+      insert_span (info, iter, span->text, -1, span->pixbuf, span->tags);
 
-	  gtk_text_buffer_apply_tag (info->buffer, tag,
-				     &start_iter, iter);
-
-	  tags = tags->next;
-	}
-
-      gtk_text_buffer_move_mark (info->buffer, mark, iter);
+      if (span->pixbuf)
+        g_object_unref (span->pixbuf);
 
       tmp = tmp->next;
     }
 
-  gtk_text_buffer_delete_mark (info->buffer, mark);
+  gtk_text_buffer_delete_mark (info->buffer, info->insert_mark);
+  info->insert_mark = NULL;
 }
 
 
@@ -1870,3 +2113,266 @@ _gtk_text_buffer_deserialize_rich_text (GtkTextBuffer *register_buffer,
 
   return retval;
 }
+
+static gboolean
+read_section_header (GInputStream  *stream,
+                     const gchar   *id,
+                     gint          *length,
+                     gboolean      *eof,
+                     GCancellable  *cancellable,
+                     GError       **error)
+{
+  guchar header[30];
+  gsize bytes_read;
+
+  *eof = FALSE;
+
+  if (!g_input_stream_read_all (stream, header, sizeof (header), &bytes_read,
+                                cancellable, error))
+    return FALSE;
+
+  if (bytes_read == 0)
+    {
+      *eof = TRUE;
+      return TRUE;
+    }
+
+  if (bytes_read < sizeof (header) ||
+      strncmp ((gchar *) header, id, 26) != 0)
+    {
+      g_set_error_literal (error,
+                           G_MARKUP_ERROR,
+                           G_MARKUP_ERROR_PARSE,
+                           _("Serialized data is malformed"));
+      return FALSE;
+    }
+
+  *length = read_int (header + 26);
+
+  if (*length < 0)
+    {
+      g_set_error_literal (error,
+                           G_MARKUP_ERROR,
+                           G_MARKUP_ERROR_PARSE,
+                           _("Serialized data is malformed"));
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+/* Inserts the pixbufs stored after the text at the positions where
+ * they were referenced.
+ */
+static gboolean
+deserialize_pixbufs_from_stream (ParseInfo     *info,
+                                 GInputStream  *stream,
+                                 GCancellable  *cancellable,
+                                 GError       **error)
+{
+  guint first_pending = 0;
+  gint index;
+
+  for (index = 0; first_pending < info->pixbuf_marks->len; index++)
+    {
+      GdkPixdata pixdata;
+      GdkPixbuf *pixbuf;
+      guint8 *data;
+      gsize bytes_read;
+      gint length;
+      gboolean eof;
+      guint i;
+
+      if (!read_section_header (stream, "GTKTEXTBUFFERPIXBDATA-0001",
+                                &length, &eof, cancellable, error))
+        return FALSE;
+
+      if (eof)
+        break;
+
+      data = g_malloc (length);
+
+      if (!g_input_stream_read_all (stream, data, length, &bytes_read,
+                                    cancellable, error))
+        {
+          g_free (data);
+          return FALSE;
+        }
+
+      pixbuf = NULL;
+      if (bytes_read == (gsize) length &&
+          gdk_pixdata_deserialize (&pixdata, length, data, error))
+        pixbuf = gdk_pixbuf_from_pixdata (&pixdata, TRUE, error);
+
+      g_free (data);
+
+      if (!pixbuf)
+        {
+          if (error && *error == NULL)
+            g_set_error_literal (error,
+                                 G_MARKUP_ERROR,
+                                 G_MARKUP_ERROR_PARSE,
+                                 _("Serialized data is malformed"));
+          return FALSE;
+        }
+
+      for (i = first_pending; i < info->pixbuf_marks->len; i++)
+        {
+          PixbufMark *pixbuf_mark = g_ptr_array_index (info->pixbuf_marks, i);
+          GtkTextIter start_iter, iter;
+          GSList *tags;
+          guint j;
+
+          if (pixbuf_mark->index != index)
+            continue;
+
+          gtk_text_buffer_get_iter_at_mark (info->buffer, &iter, pixbuf_mark->mark);
+          gtk_text_buffer_insert_pixbuf (info->buffer, &iter, pixbuf);
+
+          start_iter = iter;
+          gtk_text_iter_backward_char (&start_iter);
+
+          for (tags = pixbuf_mark->tags; tags; tags = tags->next)
+            gtk_text_buffer_apply_tag (info->buffer, tags->data,
+                                       &start_iter, &iter);
+
+          /* Pixbufs that followed this one directly share its mark
+           * position; keep them after it.
+           */
+          for (j = i + 1; j < info->pixbuf_marks->len; j++)
+            {
+              PixbufMark *next = g_ptr_array_index (info->pixbuf_marks, j);
+              GtkTextIter next_iter;
+
+              gtk_text_buffer_get_iter_at_mark (info->buffer, &next_iter, next->mark);
+              if (gtk_text_iter_get_offset (&next_iter) != gtk_text_iter_get_offset (&iter) - 1)
+                break;
+
+              gtk_text_buffer_move_mark (info->buffer, next->mark, &iter);
+            }
+
+          pixbuf_mark->index = -1;
+
+          if (i == first_pending)
+            first_pending++;
+        }
+
+      g_object_unref (pixbuf);
+
+      while (first_pending < info->pixbuf_marks->len &&
+             ((PixbufMark *) g_ptr_array_index (info->pixbuf_marks, first_pending))->index < 0)
+        first_pending++;
+    }
+
+  return TRUE;
+}
+
+gboolean
+_gtk_text_buffer_deserialize_rich_text_from_stream (GtkTextBuffer *register_buffer,
+                                                    GtkTextBuffer *content_buffer,
+                                                    GtkTextIter   *iter,
+                                                    GInputStream  *stream,
+                                                    gboolean       create_tags,
+                                                    GCancellable  *cancellable,
+                                                    GError       **error)
+{
+  GMarkupParseContext *context;
+  ParseInfo info;
+  gchar *buffer;
+  gint remaining;
+  gboolean eof;
+  gboolean retval = FALSE;
+  guint i;
+
+  static const GMarkupParser rich_text_parser = {
+    start_element_handler,
+    end_element_handler,
+    text_handler,
+    NULL,
+    NULL
+  };
+
+  if (!read_section_header (stream, "GTKTEXTBUFFERCONTENTS-0001",
+                            &remaining, &eof, cancellable, error))
+    return FALSE;
+
+  if (eof)
+    {
+      g_set_error_literal (error,
+                           G_MARKUP_ERROR,
+                           G_MARKUP_ERROR_PARSE,
+                           _("Serialized data is malformed. First section isn't GTKTEXTBUFFERCONTENTS-0001"));
+      return FALSE;
+    }
+
+  parse_info_init (&info, content_buffer, create_tags, NULL);
+
+  info.iter = iter;
+  info.insert_mark = gtk_text_buffer_create_mark (content_buffer, "deserialize_insert_point",
+                                                  iter, TRUE);
+  info.pixbuf_marks = g_ptr_array_new ();
+
+  context = g_markup_parse_context_new (&rich_text_parser,
+                                        0, &info, NULL);
+
+  buffer = g_malloc (SERIALIZE_CHUNK_SIZE);
+
+  while (remaining > 0)
+    {
+      gsize bytes_read;
+
+      if (!g_input_stream_read_all (stream, buffer,
+                                    MIN (remaining, SERIALIZE_CHUNK_SIZE),
+                                    &bytes_read, cancellable, error))
+        goto out;
+
+      if (bytes_read == 0)
+        {
+          g_set_error_literal (error,
+                               G_MARKUP_ERROR,
+                               G_MARKUP_ERROR_PARSE,
+                               _("Serialized data is malformed"));
+          goto out;
+        }
+
+      if (!g_markup_parse_context_parse (context, buffer, bytes_read, error))
+        goto out;
+
+      remaining -= bytes_read;
+    }
+
+  if (!g_markup_parse_context_end_parse (context, error))
+    goto out;
+
+  /* Pixbufs may still be inserted at the end of the text, so track
+   * it with a mark that moves along with them */
+  gtk_text_buffer_get_iter_at_mark (content_buffer, iter, info.insert_mark);
+  gtk_text_buffer_delete_mark (content_buffer, info.insert_mark);
+  info.insert_mark = gtk_text_buffer_create_mark (content_buffer, "deserialize_insert_point",
+                                                  iter, FALSE);
+
+  retval = deserialize_pixbufs_from_stream (&info, stream, cancellable, error);
+
+ out:
+  g_free (buffer);
+
+  /* Leave @iter after the inserted text */
+  gtk_text_buffer_get_iter_at_mark (content_buffer, iter, info.insert_mark);
+  gtk_text_buffer_delete_mark (content_buffer, info.insert_mark);
+
+  for (i = 0; i < info.pixbuf_marks->len; i++)
+    {
+      PixbufMark *pixbuf_mark = g_ptr_array_index (info.pixbuf_marks, i);
+
+      gtk_text_buffer_delete_mark (content_buffer, pixbuf_mark->mark);
+      g_slist_free (pixbuf_mark->tags);
+      g_free (pixbuf_mark);
+    }
+  g_ptr_array_free (info.pixbuf_marks, TRUE);
+
+  parse_info_free (&info);
+
+  g_markup_parse_context_free (context);
+
+  return retval;
+}
@@ -39,5 +39,20 @@ gboolean _gtk_text_buffer_deserialize_rich_text (GtkTextBuffer     *register_buf
                                                  gpointer           user_data,
                                                  GError           **error);
 
+gboolean _gtk_text_buffer_serialize_rich_text_to_stream     (GtkTextBuffer     *register_buffer,
+                                                             GtkTextBuffer     *content_buffer,
+                                                             const GtkTextIter *start,
+                                                             const GtkTextIter *end,
+                                                             GOutputStream     *stream,
+                                                             GCancellable      *cancellable,
+                                                             GError           **error);
+
+gboolean _gtk_text_buffer_deserialize_rich_text_from_stream (GtkTextBuffer     *register_buffer,
+                                                             GtkTextBuffer     *content_buffer,
+                                                             GtkTextIter       *iter,
+                                                             GInputStream      *stream,
+                                                             gboolean           create_tags,
+                                                             GCancellable      *cancellable,
+                                                             GError           **error);
 
 #endif /* __GTK_TEXT_BUFFER_SERIALIZE_H__ */
@@ -707,6 +707,110 @@ render_para (GtkTextRenderer    *text_renderer,
   pango_layout_iter_free (iter);
 }
 
+/* Paragraphs bigger than this in either direction are always
+ * rendered directly rather than through a cached pixmap.
+ */
+#define MAX_CACHED_PARA_SIZE 4096
+
+/* Draws the paragraph from the pixmap kept on @line_display, rendering
+ * it into the pixmap first when needed. Returns %FALSE if the paragraph
+ * can't be cached and has to be rendered with render_para() instead.
+ */
+static gboolean
+render_para_cached (GtkTextRenderer    *text_renderer,
+                    GtkTextLayout      *layout,
+                    GtkTextLineDisplay *line_display,
+                    int                 x,
+                    int                 y,
+                    int                 selection_start_index,
+                    int                 selection_end_index)
+{
+  GtkWidget *widget = text_renderer->widget;
+  GdkDrawable *drawable = text_renderer->drawable;
+  GdkRectangle clip = text_renderer->clip_rect;
+  GdkRectangle para_rect;
+  GdkRectangle draw_rect;
+  gboolean has_focus;
+  gint width;
+
+  /* The block cursor is drawn as part of the paragraph */
+  if (line_display->has_block_cursor || line_display->pixmap_uncacheable)
+    return FALSE;
+
+  has_focus = GTK_WIDGET_HAS_FOCUS (widget) != FALSE;
+
+  if (line_display->pixmap &&
+      (line_display->pixmap_selection_start != selection_start_index ||
+       line_display->pixmap_selection_end != selection_end_index ||
+       line_display->pixmap_state != widget->state ||
+       line_display->pixmap_has_focus != has_focus))
+    _gtk_text_layout_drop_display_pixmap (layout, line_display);
+
+  width = MAX (line_display->left_margin + line_display->total_width + line_display->right_margin,
+               line_display->x_offset + line_display->width - line_display->left_margin);
+
+  if (!line_display->pixmap)
+    {
+      GdkRectangle pixmap_clip;
+      GList *widgets;
+
+      if (width > MAX_CACHED_PARA_SIZE ||
+          line_display->height > MAX_CACHED_PARA_SIZE ||
+          !_gtk_text_layout_reserve_display_pixmap (layout, line_display,
+                                                    width, line_display->height))
+        return FALSE;
+
+      line_display->pixmap = gdk_pixmap_new (drawable, width, line_display->height, -1);
+      line_display->pixmap_selection_start = selection_start_index;
+      line_display->pixmap_selection_end = selection_end_index;
+      line_display->pixmap_state = widget->state;
+      line_display->pixmap_has_focus = has_focus;
+
+      gdk_draw_rectangle (line_display->pixmap,
+                          widget->style->base_gc[widget->state],
+                          TRUE,
+                          0, 0,
+                          width, line_display->height);
+
+      pixmap_clip.x = 0;
+      pixmap_clip.y = 0;
+      pixmap_clip.width = width;
+      pixmap_clip.height = line_display->height;
+
+      widgets = text_renderer->widgets;
+
+      text_renderer_begin (text_renderer, widget, line_display->pixmap, &pixmap_clip);
+      render_para (text_renderer, line_display, 0, 0,
+                   selection_start_index, selection_end_index);
+      text_renderer_begin (text_renderer, widget, drawable, &clip);
+
+      /* Child widgets are exposed separately, and keeping the paragraph
+       * around would skip them on the next expose, so only use the
+       * pixmap this once.
+       */
+      if (text_renderer->widgets != widgets)
+        line_display->pixmap_uncacheable = TRUE;
+    }
+
+  para_rect.x = x;
+  para_rect.y = y;
+  para_rect.width = width;
+  para_rect.height = line_display->height;
+
+  if (gdk_rectangle_intersect (&para_rect, &clip, &draw_rect))
+    gdk_draw_drawable (drawable,
+                       widget->style->base_gc[widget->state],
+                       line_display->pixmap,
+                       draw_rect.x - x, draw_rect.y - y,
+                       draw_rect.x, draw_rect.y,
+                       draw_rect.width, draw_rect.height);
+
+  if (line_display->pixmap_uncacheable)
+    _gtk_text_layout_drop_display_pixmap (layout, line_display);
+
+  return TRUE;
+}
+
 static void
 on_renderer_display_closed (GdkDisplay       *display,
                             gboolean          is_error,
@@ -769,6 +873,7 @@ gtk_text_layout_draw (GtkTextLayout *layout,
   GSList *line_list;
   GSList *tmp_list;
   GList *tmp_widgets;
+  gboolean cache_rendering;
   
   g_return_if_fail (GTK_IS_TEXT_LAYOUT (layout));
   g_return_if_fail (layout->default_style != NULL);
@@ -795,6 +900,8 @@ gtk_text_layout_draw (GtkTextLayout *layout,
 
   text_renderer_begin (text_renderer, widget, drawable, &clip);
 
+  cache_rendering = gtk_text_layout_get_cache_rendering (layout);
+
   gtk_text_layout_wrap_loop_start (layout);
 
   if (gtk_text_buffer_get_selection_bounds (layout->buffer,
@@ -847,10 +954,15 @@ gtk_text_layout_draw (GtkTextLayout *layout,
                 }
             }
 
-          render_para (text_renderer, line_display,
-                       - x_offset,
-                       current_y,
-                       selection_start_index, selection_end_index);
+          if (!cache_rendering ||
+              !render_para_cached (text_renderer, layout, line_display,
+                                   - x_offset,
+                                   current_y,
+                                   selection_start_index, selection_end_index))
+            render_para (text_renderer, line_display,
+                         - x_offset,
+                         current_y,
+                         selection_start_index, selection_end_index);
 
           /* We paint the cursors last, because they overlap another chunk
          and need to appear on top. */
@@ -4409,11 +4409,105 @@ forward_chars_with_skipping (GtkTextIter *iter,
     }
 }
 
+/* Case insensitive matching compares one character at a time, so a
+ * match always has as many characters as the search string. That
+ * keeps the character offsets computed by the search code valid.
+ */
+static gboolean
+search_has_prefix (const gchar  *string,
+                   const gchar  *prefix,
+                   gboolean      case_insensitive,
+                   const gchar **match_end)
+{
+  if (!case_insensitive)
+    {
+      gsize len = strlen (prefix);
+
+      if (strncmp (string, prefix, len) != 0)
+        return FALSE;
+
+      if (match_end)
+        *match_end = string + len;
+      return TRUE;
+    }
+
+  while (*prefix)
+    {
+      if (*string == '\0' ||
+          g_unichar_tolower (g_utf8_get_char (string)) !=
+          g_unichar_tolower (g_utf8_get_char (prefix)))
+        return FALSE;
+
+      string = g_utf8_next_char (string);
+      prefix = g_utf8_next_char (prefix);
+    }
+
+  if (match_end)
+    *match_end = string;
+  return TRUE;
+}
+
+static gboolean
+search_equal (const gchar *a,
+              const gchar *b,
+              gboolean     case_insensitive)
+{
+  const gchar *end;
+
+  return search_has_prefix (a, b, case_insensitive, &end) && *end == '\0';
+}
+
+static const gchar *
+search_find (const gchar  *haystack,
+             const gchar  *needle,
+             gboolean      case_insensitive,
+             const gchar **match_end)
+{
+  const gchar *p;
+
+  if (!case_insensitive)
+    {
+      p = strstr (haystack, needle);
+      if (p && match_end)
+        *match_end = p + strlen (needle);
+      return p;
+    }
+
+  for (p = haystack; *p; p = g_utf8_next_char (p))
+    {
+      if (search_has_prefix (p, needle, TRUE, match_end))
+        return p;
+    }
+
+  return NULL;
+}
+
+static const gchar *
+search_rfind (const gchar *haystack,
+              const gchar *needle,
+              gboolean     case_insensitive)
+{
+  const gchar *p;
+  const gchar *found = NULL;
+
+  if (!case_insensitive)
+    return g_strrstr (haystack, needle);
+
+  for (p = haystack; *p; p = g_utf8_next_char (p))
+    {
+      if (search_has_prefix (p, needle, TRUE, NULL))
+        found = p;
+    }
+
+  return found;
+}
+
 static gboolean
 lines_match (const GtkTextIter *start,
              const gchar **lines,
              gboolean visible_only,
              gboolean slice,
+             gboolean case_insensitive,
              GtkTextIter *match_start,
              GtkTextIter *match_end)
 {
@@ -4457,13 +4551,13 @@ lines_match (const GtkTextIter *start,
     }
 
   if (match_start) /* if this is the first line we're matching */
-    found = strstr (line_text, *lines);
+    found = search_find (line_text, *lines, case_insensitive, NULL);
   else
     {
       /* If it's not the first line, we have to match from the
        * start of the line.
        */
-      if (strncmp (line_text, *lines, strlen (*lines)) == 0)
+      if (search_has_prefix (line_text, *lines, case_insensitive, NULL))
         found = line_text;
       else
         found = NULL;
@@ -4507,7 +4601,8 @@ lines_match (const GtkTextIter *start,
   /* pass NULL for match_start, since we don't need to find the
    * start again.
    */
-  return lines_match (&next, lines, visible_only, slice, NULL, match_end);
+  return lines_match (&next, lines, visible_only, slice, case_insensitive,
+                      NULL, match_end);
 }
 
 /* strsplit () that retains the delimiter as part of the string. */
@@ -4566,39 +4661,145 @@ strbreakup (const char *string,
   return str_array;
 }
 
-/**
- * gtk_text_iter_forward_search:
- * @iter: start of search
- * @str: a search string
- * @flags: flags affecting how the search is done
- * @match_start: return location for start of match, or %NULL
- * @match_end: return location for end of match, or %NULL
- * @limit: bound for the search, or %NULL for the end of the buffer
- * 
- * Searches forward for @str. Any match is returned by setting 
- * @match_start to the first character of the match and @match_end to the 
- * first character after the match. The search will not continue past
- * @limit. Note that a search is a linear or O(n) operation, so you
- * may wish to use @limit to avoid locking up your UI on large
- * buffers.
- * 
- * If the #GTK_TEXT_SEARCH_VISIBLE_ONLY flag is present, the match may
- * have invisible text interspersed in @str. i.e. @str will be a
- * possibly-noncontiguous subsequence of the matched range. similarly,
- * if you specify #GTK_TEXT_SEARCH_TEXT_ONLY, the match may have
- * pixbufs or child widgets mixed inside the matched range. If these
- * flags are not given, the match must be exact; the special 0xFFFC
- * character in @str will match embedded pixbufs or child widgets.
- *
- * Return value: whether a match was found
- **/
-gboolean
-gtk_text_iter_forward_search (const GtkTextIter *iter,
-                              const gchar       *str,
-                              GtkTextSearchFlags flags,
-                              GtkTextIter       *match_start,
-                              GtkTextIter       *match_end,
-                              const GtkTextIter *limit)
+typedef gboolean (* SearchMatchFunc) (const GtkTextIter *match_start,
+                                      const GtkTextIter *match_end,
+                                      gpointer           user_data);
+
+/* Searches forward from @iter for @needle, which must not contain a
+ * newline, calling @func for each match that ends before @limit until
+ * it returns %FALSE. Matches don't overlap. The text of each line is
+ * copied straight from its segments into a single reused buffer,
+ * instead of allocating a new string for every line as lines_match()
+ * does; this only works when all characters take part in the search,
+ * i.e. neither GTK_TEXT_SEARCH_VISIBLE_ONLY nor GTK_TEXT_SEARCH_TEXT_ONLY
+ * is given. Pixbufs and child anchors take up 3 bytes in a line, the
+ * size of 0xFFFC in UTF-8, so byte offsets in the buffer are line
+ * indexes.
+ */
+static void
+scan_lines_forward (const GtkTextIter *iter,
+                    const gchar       *needle,
+                    gboolean           case_insensitive,
+                    gboolean           whole_word,
+                    const GtkTextIter *limit,
+                    SearchMatchFunc    func,
+                    gpointer           user_data)
+{
+  GString *text;
+  GtkTextIter line_start;
+  gint start_index;
+
+  text = g_string_new (NULL);
+
+  line_start = *iter;
+  start_index = gtk_text_iter_get_line_index (iter);
+  gtk_text_iter_set_line_index (&line_start, 0);
+
+  while (TRUE)
+    {
+      GtkTextLine *line;
+      GtkTextLineSegment *seg;
+      GtkTextIter next;
+      gboolean last_line;
+      const gchar *p;
+      const gchar *found;
+      const gchar *found_end;
+
+      if (limit &&
+          gtk_text_iter_compare (&line_start, limit) >= 0)
+        break;
+
+      line = _gtk_text_iter_get_text_line (&line_start);
+
+      g_string_truncate (text, 0);
+      for (seg = line->segments; seg != NULL; seg = seg->next)
+        {
+          if (seg->type == &gtk_text_char_type)
+            g_string_append_len (text, seg->body.chars, seg->byte_count);
+          else if (seg->byte_count > 0)
+            g_string_append (text, "\xef\xbf\xbc");
+        }
+
+      next = line_start;
+      last_line = !gtk_text_iter_forward_line (&next);
+
+      /* The last line has a newline that isn't part of the buffer */
+      if (last_line)
+        g_string_truncate (text, gtk_text_iter_get_line_index (&next));
+
+      p = text->str + start_index;
+      while ((found = search_find (p, needle, case_insensitive, &found_end)))
+        {
+          GtkTextIter match_start;
+          GtkTextIter match_end;
+
+          match_start = line_start;
+          gtk_text_iter_set_line_index (&match_start, found - text->str);
+
+          if (found_end - text->str == (gssize) text->len)
+            match_end = next;
+          else
+            {
+              match_end = line_start;
+              gtk_text_iter_set_line_index (&match_end, found_end - text->str);
+            }
+
+          if (limit &&
+              gtk_text_iter_compare (&match_end, limit) > 0)
+            goto out;
+
+          if (!whole_word ||
+              (gtk_text_iter_starts_word (&match_start) &&
+               gtk_text_iter_ends_word (&match_end)))
+            {
+              if (!(* func) (&match_start, &match_end, user_data))
+                goto out;
+
+              p = found_end;
+            }
+          else
+            p = g_utf8_next_char (found);
+        }
+
+      if (last_line)
+        break;
+
+      line_start = next;
+      start_index = 0;
+    }
+
+ out:
+  g_string_free (text, TRUE);
+}
+
+typedef struct
+{
+  GtkTextIter match_start;
+  GtkTextIter match_end;
+  gboolean found;
+} FirstMatch;
+
+static gboolean
+first_match_func (const GtkTextIter *match_start,
+                  const GtkTextIter *match_end,
+                  gpointer           user_data)
+{
+  FirstMatch *first = user_data;
+
+  first->match_start = *match_start;
+  first->match_end = *match_end;
+  first->found = TRUE;
+
+  return FALSE;
+}
+
+static gboolean
+forward_search (const GtkTextIter *iter,
+                const gchar       *str,
+                GtkTextSearchFlags flags,
+                GtkTextIter       *match_start,
+                GtkTextIter       *match_end,
+                const GtkTextIter *limit)
 {
   gchar **lines = NULL;
   GtkTextIter match;
@@ -4606,9 +4807,7 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
   GtkTextIter search;
   gboolean visible_only;
   gboolean slice;
-  
-  g_return_val_if_fail (iter != NULL, FALSE);
-  g_return_val_if_fail (str != NULL, FALSE);
+  gboolean case_insensitive;
 
   if (limit &&
       gtk_text_iter_compare (iter, limit) >= 0)
@@ -4637,11 +4836,33 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
 
   visible_only = (flags & GTK_TEXT_SEARCH_VISIBLE_ONLY) != 0;
   slice = (flags & GTK_TEXT_SEARCH_TEXT_ONLY) == 0;
-  
+  case_insensitive = (flags & GTK_TEXT_SEARCH_CASE_INSENSITIVE) != 0;
+
   /* locate all lines */
 
   lines = strbreakup (str, "\n", -1);
 
+  if (lines[1] == NULL && !visible_only && slice)
+    {
+      FirstMatch first;
+
+      first.found = FALSE;
+      scan_lines_forward (iter, lines[0], case_insensitive, FALSE, limit,
+                          first_match_func, &first);
+
+      if (first.found)
+        {
+          if (match_start)
+            *match_start = first.match_start;
+          if (match_end)
+            *match_end = first.match_end;
+        }
+
+      g_strfreev (lines);
+
+      return first.found;
+    }
+
   search = *iter;
 
   do
@@ -4657,7 +4878,7 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
         break;
       
       if (lines_match (&search, (const gchar**)lines,
-                       visible_only, slice, &match, &end))
+                       visible_only, slice, case_insensitive, &match, &end))
         {
           if (limit == NULL ||
               (limit &&
@@ -4682,9 +4903,178 @@ gtk_text_iter_forward_search (const GtkTextIter *iter,
   return retval;
 }
 
+/**
+ * gtk_text_iter_forward_search:
+ * @iter: start of search
+ * @str: a search string
+ * @flags: flags affecting how the search is done
+ * @match_start: return location for start of match, or %NULL
+ * @match_end: return location for end of match, or %NULL
+ * @limit: bound for the search, or %NULL for the end of the buffer
+ * 
+ * Searches forward for @str. Any match is returned by setting 
+ * @match_start to the first character of the match and @match_end to the 
+ * first character after the match. The search will not continue past
+ * @limit. Note that a search is a linear or O(n) operation, so you
+ * may wish to use @limit to avoid locking up your UI on large
+ * buffers.
+ * 
+ * If the #GTK_TEXT_SEARCH_VISIBLE_ONLY flag is present, the match may
+ * have invisible text interspersed in @str. i.e. @str will be a
+ * possibly-noncontiguous subsequence of the matched range. similarly,
+ * if you specify #GTK_TEXT_SEARCH_TEXT_ONLY, the match may have
+ * pixbufs or child widgets mixed inside the matched range. If these
+ * flags are not given, the match must be exact; the special 0xFFFC
+ * character in @str will match embedded pixbufs or child widgets.
+ *
+ * If #GTK_TEXT_SEARCH_CASE_INSENSITIVE is given, characters are
+ * compared ignoring their case. If #GTK_TEXT_SEARCH_WHOLE_WORD is
+ * given, only matches that start and end at word boundaries are
+ * found.
+ *
+ * Return value: whether a match was found
+ **/
+gboolean
+gtk_text_iter_forward_search (const GtkTextIter *iter,
+                              const gchar       *str,
+                              GtkTextSearchFlags flags,
+                              GtkTextIter       *match_start,
+                              GtkTextIter       *match_end,
+                              const GtkTextIter *limit)
+{
+  GtkTextIter search;
+  GtkTextIter start;
+  GtkTextIter end;
+
+  g_return_val_if_fail (iter != NULL, FALSE);
+  g_return_val_if_fail (str != NULL, FALSE);
+
+  if ((flags & GTK_TEXT_SEARCH_WHOLE_WORD) == 0)
+    return forward_search (iter, str, flags, match_start, match_end, limit);
+
+  search = *iter;
+  while (forward_search (&search, str, flags, &start, &end, limit))
+    {
+      if (gtk_text_iter_starts_word (&start) &&
+          gtk_text_iter_ends_word (&end))
+        {
+          if (match_start)
+            *match_start = start;
+          if (match_end)
+            *match_end = end;
+          return TRUE;
+        }
+
+      search = start;
+      if (!gtk_text_iter_forward_char (&search))
+        break;
+    }
+
+  return FALSE;
+}
+
 static gboolean
-vectors_equal_ignoring_trailing (gchar **vec1,
-                                 gchar **vec2)
+append_match_func (const GtkTextIter *match_start,
+                   const GtkTextIter *match_end,
+                   gpointer           user_data)
+{
+  GArray *offsets = user_data;
+  gint offset;
+
+  offset = gtk_text_iter_get_offset (match_start);
+  g_array_append_val (offsets, offset);
+  offset = gtk_text_iter_get_offset (match_end);
+  g_array_append_val (offsets, offset);
+
+  return TRUE;
+}
+
+/**
+ * gtk_text_iter_forward_search_all:
+ * @iter: start of search
+ * @str: a search string
+ * @flags: flags affecting how the search is done
+ * @limit: bound for the search, or %NULL for the end of the buffer
+ * @n_matches: return location for the number of matches
+ *
+ * Finds all non-overlapping matches of @str after @iter in a single
+ * pass over the buffer, with the same rules as
+ * gtk_text_iter_forward_search(). This is a lot faster than calling
+ * gtk_text_iter_forward_search() repeatedly, especially when neither
+ * #GTK_TEXT_SEARCH_VISIBLE_ONLY nor #GTK_TEXT_SEARCH_TEXT_ONLY is given
+ * and @str is a single line.
+ *
+ * The matches are returned as pairs of character offsets, the start
+ * of a match followed by its end, in buffer order.
+ *
+ * Return value: a newly-allocated array of 2 * @n_matches character
+ *   offsets, or %NULL if there were no matches. Free it with g_free().
+ *
+ * Since: 2.18
+ **/
+gint *
+gtk_text_iter_forward_search_all (const GtkTextIter *iter,
+                                  const gchar       *str,
+                                  GtkTextSearchFlags flags,
+                                  const GtkTextIter *limit,
+                                  gint              *n_matches)
+{
+  GArray *offsets;
+
+  g_return_val_if_fail (iter != NULL, NULL);
+  g_return_val_if_fail (str != NULL, NULL);
+  g_return_val_if_fail (n_matches != NULL, NULL);
+
+  *n_matches = 0;
+
+  if (*str == '\0')
+    return NULL;
+
+  offsets = g_array_new (FALSE, FALSE, sizeof (gint));
+
+  if (strchr (str, '\n') == NULL &&
+      (flags & (GTK_TEXT_SEARCH_VISIBLE_ONLY | GTK_TEXT_SEARCH_TEXT_ONLY)) == 0)
+    {
+      scan_lines_forward (iter, str,
+                          (flags & GTK_TEXT_SEARCH_CASE_INSENSITIVE) != 0,
+                          (flags & GTK_TEXT_SEARCH_WHOLE_WORD) != 0,
+                          limit, append_match_func, offsets);
+    }
+  else
+    {
+      GtkTextIter search = *iter;
+      GtkTextIter match_start, match_end;
+
+      while (gtk_text_iter_forward_search (&search, str, flags,
+                                           &match_start, &match_end, limit))
+        {
+          append_match_func (&match_start, &match_end, offsets);
+
+          /* Invisible or non-text characters may be skipped by
+           * the match, make sure we always make progress.
+           */
+          search = match_end;
+          if (gtk_text_iter_equal (&match_start, &match_end) &&
+              !gtk_text_iter_forward_char (&search))
+            break;
+        }
+    }
+
+  *n_matches = offsets->len / 2;
+
+  if (*n_matches == 0)
+    {
+      g_array_free (offsets, TRUE);
+      return NULL;
+    }
+
+  return (gint *) g_array_free (offsets, FALSE);
+}
+
+static gboolean
+vectors_equal_ignoring_trailing (gchar  **vec1,
+                                 gchar  **vec2,
+                                 gboolean case_insensitive)
 {
   /* Ignores trailing chars in vec2's last line */
 
@@ -4695,15 +5085,11 @@ vectors_equal_ignoring_trailing (gchar **vec1,
 
   while (*i1 && *i2)
     {
-      if (strcmp (*i1, *i2) != 0)
+      if (!search_equal (*i2, *i1, case_insensitive))
         {
           if (*(i2 + 1) == NULL) /* if this is the last line */
             {
-              gint len1 = strlen (*i1);
-              gint len2 = strlen (*i2);
-
-              if (len2 >= len1 &&
-                  strncmp (*i1, *i2, len1) == 0)
+              if (search_has_prefix (*i2, *i1, case_insensitive, NULL))
                 {
                   /* We matched ignoring the trailing stuff in vec2 */
                   return TRUE;
@@ -4863,26 +5249,13 @@ lines_window_free (LinesWindow *win)
   g_strfreev (win->lines);
 }
 
-/**
- * gtk_text_iter_backward_search:
- * @iter: a #GtkTextIter where the search begins
- * @str: search string
- * @flags: bitmask of flags affecting the search
- * @match_start: return location for start of match, or %NULL
- * @match_end: return location for end of match, or %NULL
- * @limit: location of last possible @match_start, or %NULL for start of buffer
- * 
- * Same as gtk_text_iter_forward_search(), but moves backward.
- * 
- * Return value: whether a match was found
- **/
-gboolean
-gtk_text_iter_backward_search (const GtkTextIter *iter,
-                               const gchar       *str,
-                               GtkTextSearchFlags flags,
-                               GtkTextIter       *match_start,
-                               GtkTextIter       *match_end,
-                               const GtkTextIter *limit)
+static gboolean
+backward_search (const GtkTextIter *iter,
+                 const gchar       *str,
+                 GtkTextSearchFlags flags,
+                 GtkTextIter       *match_start,
+                 GtkTextIter       *match_end,
+                 const GtkTextIter *limit)
 {
   gchar **lines = NULL;
   gchar **l;
@@ -4891,9 +5264,7 @@ gtk_text_iter_backward_search (const GtkTextIter *iter,
   gboolean retval = FALSE;
   gboolean visible_only;
   gboolean slice;
-  
-  g_return_val_if_fail (iter != NULL, FALSE);
-  g_return_val_if_fail (str != NULL, FALSE);
+  gboolean case_insensitive;
 
   if (limit &&
       gtk_text_iter_compare (limit, iter) > 0)
@@ -4921,6 +5292,7 @@ gtk_text_iter_backward_search (const GtkTextIter *iter,
 
   visible_only = (flags & GTK_TEXT_SEARCH_VISIBLE_ONLY) != 0;
   slice = (flags & GTK_TEXT_SEARCH_TEXT_ONLY) == 0;
+  case_insensitive = (flags & GTK_TEXT_SEARCH_CASE_INSENSITIVE) != 0;
   
   /* locate all lines */
 
@@ -4945,7 +5317,7 @@ gtk_text_iter_backward_search (const GtkTextIter *iter,
 
   do
     {
-      gchar *first_line_match;
+      const gchar *first_line_match;
 
       if (limit &&
           gtk_text_iter_compare (limit, &win.first_line_end) > 0)
@@ -4958,10 +5330,11 @@ gtk_text_iter_backward_search (const GtkTextIter *iter,
        * end in '\n', so this will only match at the
        * end of the first line, which is correct.
        */
-      first_line_match = g_strrstr (*win.lines, *lines);
+      first_line_match = search_rfind (*win.lines, *lines, case_insensitive);
 
       if (first_line_match &&
-          vectors_equal_ignoring_trailing (lines + 1, win.lines + 1))
+          vectors_equal_ignoring_trailing (lines + 1, win.lines + 1,
+                                           case_insensitive))
         {
           /* Match! */
           gint offset;
@@ -5010,6 +5383,61 @@ gtk_text_iter_backward_search (const GtkTextIter *iter,
   return retval;
 }
 
+/**
+ * gtk_text_iter_backward_search:
+ * @iter: a #GtkTextIter where the search begins
+ * @str: search string
+ * @flags: bitmask of flags affecting the search
+ * @match_start: return location for start of match, or %NULL
+ * @match_end: return location for end of match, or %NULL
+ * @limit: location of last possible @match_start, or %NULL for start of buffer
+ * 
+ * Same as gtk_text_iter_forward_search(), but moves backward.
+ * 
+ * Return value: whether a match was found
+ **/
+gboolean
+gtk_text_iter_backward_search (const GtkTextIter *iter,
+                               const gchar       *str,
+                               GtkTextSearchFlags flags,
+                               GtkTextIter       *match_start,
+                               GtkTextIter       *match_end,
+                               const GtkTextIter *limit)
+{
+  GtkTextIter search;
+  GtkTextIter start;
+  GtkTextIter end;
+
+  g_return_val_if_fail (iter != NULL, FALSE);
+  g_return_val_if_fail (str != NULL, FALSE);
+
+  if ((flags & GTK_TEXT_SEARCH_WHOLE_WORD) == 0)
+    return backward_search (iter, str, flags, match_start, match_end, limit);
+
+  search = *iter;
+  while (backward_search (&search, str, flags, &start, &end, limit))
+    {
+      if (gtk_text_iter_starts_word (&start) &&
+          gtk_text_iter_ends_word (&end))
+        {
+          if (match_start)
+            *match_start = start;
+          if (match_end)
+            *match_end = end;
+          return TRUE;
+        }
+
+      /* Matches overlapping this one but starting earlier end
+       * before its last character.
+       */
+      search = end;
+      if (!gtk_text_iter_backward_char (&search))
+        break;
+    }
+
+  return FALSE;
+}
+
 /*
  * Comparisons
  */
@@ -37,9 +37,11 @@
 G_BEGIN_DECLS
 
 typedef enum {
-  GTK_TEXT_SEARCH_VISIBLE_ONLY = 1 << 0,
-  GTK_TEXT_SEARCH_TEXT_ONLY    = 1 << 1
-  /* Possible future plans: SEARCH_CASE_INSENSITIVE, SEARCH_REGEXP */
+  GTK_TEXT_SEARCH_VISIBLE_ONLY     = 1 << 0,
+  GTK_TEXT_SEARCH_TEXT_ONLY        = 1 << 1,
+  GTK_TEXT_SEARCH_CASE_INSENSITIVE = 1 << 2,
+  GTK_TEXT_SEARCH_WHOLE_WORD       = 1 << 3
+  /* Possible future plans: SEARCH_REGEXP */
 } GtkTextSearchFlags;
 
 /*
@@ -284,6 +286,12 @@ gboolean gtk_text_iter_backward_search (const GtkTextIter *iter,
                                         GtkTextIter       *match_end,
                                         const GtkTextIter *limit);
 
+gint    *gtk_text_iter_forward_search_all (const GtkTextIter *iter,
+                                           const gchar       *str,
+                                           GtkTextSearchFlags flags,
+                                           const GtkTextIter *limit,
+                                           gint              *n_matches);
+
 
 /*
  * Comparisons
@@ -91,6 +91,16 @@
 
 #define GTK_TEXT_LAYOUT_GET_PRIVATE(o)  (G_TYPE_INSTANCE_GET_PRIVATE ((o), GTK_TYPE_TEXT_LAYOUT, GtkTextLayoutPrivate))
 
+/* Maximum number of line displays kept around; should comfortably
+ * cover the lines visible on screen.
+ */
+#define DISPLAY_CACHE_SIZE 256
+
+/* Maximum total area of the paragraph pixmaps kept around when
+ * rendering is cached; at 32 bits per pixel this is 16 MB.
+ */
+#define MAX_CACHED_PIXMAP_AREA (4096 * 1024)
+
 typedef struct _GtkTextLayoutPrivate GtkTextLayoutPrivate;
 
 struct _GtkTextLayoutPrivate
@@ -99,6 +109,20 @@ struct _GtkTextLayoutPrivate
      direction only influences the direction of the cursor line.
   */
   GtkTextLine *cursor_line;
+
+  /* Recently used line displays, most recently used first, and an
+   * index from GtkTextLine to their link in the queue. Only lines
+   * that have line data for this layout are cached, so that freeing
+   * the line data is enough to drop them from the cache.
+   */
+  GQueue display_cache;
+  GHashTable *display_cache_index;
+
+  /* Total area of the pixmaps held by cached line displays */
+  gsize pixmap_area;
+
+  /* Whether line displays keep a rendered copy of their paragraph */
+  guint cache_rendering : 1;
 };
 
 static GtkTextLineData *gtk_text_layout_real_wrap (GtkTextLayout *layout,
@@ -233,7 +257,11 @@ gtk_text_layout_class_init (GtkTextLayoutClass *klass)
 static void
 gtk_text_layout_init (GtkTextLayout *text_layout)
 {
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (text_layout);
+
   text_layout->cursor_visible = TRUE;
+
+  priv->display_cache_index = g_hash_table_new (NULL, NULL);
 }
 
 GtkTextLayout*
@@ -252,12 +280,100 @@ free_style_cache (GtkTextLayout *text_layout)
     }
 }
 
+static GtkTextLineDisplay *
+display_cache_lookup (GtkTextLayout *layout,
+                      GtkTextLine   *line)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  GList *link;
+
+  link = g_hash_table_lookup (priv->display_cache_index, line);
+  if (link == NULL)
+    return NULL;
+
+  if (link != priv->display_cache.head)
+    {
+      g_queue_unlink (&priv->display_cache, link);
+      g_queue_push_head_link (&priv->display_cache, link);
+    }
+
+  return link->data;
+}
+
+static gboolean
+display_cache_contains (GtkTextLayout      *layout,
+                        GtkTextLineDisplay *display)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  GList *link;
+
+  link = g_hash_table_lookup (priv->display_cache_index, display->line);
+
+  return link != NULL && link->data == display;
+}
+
+/* Removes the display for @line from the cache and frees it */
+static void
+display_cache_remove (GtkTextLayout *layout,
+                      GtkTextLine   *line)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  GtkTextLineDisplay *display;
+  GList *link;
+
+  link = g_hash_table_lookup (priv->display_cache_index, line);
+  if (link == NULL)
+    return;
+
+  display = link->data;
+  g_hash_table_remove (priv->display_cache_index, line);
+  g_queue_delete_link (&priv->display_cache, link);
+
+  gtk_text_layout_free_line_display (layout, display);
+}
+
+static void
+display_cache_insert (GtkTextLayout      *layout,
+                      GtkTextLineDisplay *display)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+
+  if (_gtk_text_line_get_data (display->line, layout) == NULL)
+    return;
+
+  if (priv->display_cache.length >= DISPLAY_CACHE_SIZE)
+    {
+      GtkTextLineDisplay *oldest = priv->display_cache.tail->data;
+
+      display_cache_remove (layout, oldest->line);
+    }
+
+  g_queue_push_head (&priv->display_cache, display);
+  g_hash_table_insert (priv->display_cache_index,
+                       display->line, priv->display_cache.head);
+}
+
+static void
+display_cache_clear (GtkTextLayout *layout)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+
+  while (priv->display_cache.head)
+    {
+      GtkTextLineDisplay *display = priv->display_cache.head->data;
+
+      display_cache_remove (layout, display->line);
+    }
+}
+
 static void
 gtk_text_layout_finalize (GObject *object)
 {
   GtkTextLayout *layout;
+  GtkTextLayoutPrivate *priv;
 
   layout = GTK_TEXT_LAYOUT (object);
+  priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
 
   gtk_text_layout_set_buffer (layout, NULL);
 
@@ -276,12 +392,8 @@ gtk_text_layout_finalize (GObject *object)
       layout->rtl_context = NULL;
     }
   
-  if (layout->one_display_cache) 
-    {
-      GtkTextLineDisplay *tmp_display = layout->one_display_cache;
-      layout->one_display_cache = NULL;
-      gtk_text_layout_free_line_display (layout, tmp_display);
-    }
+  display_cache_clear (layout);
+  g_hash_table_destroy (priv->display_cache_index);
 
   if (layout->preedit_string)
     {
@@ -553,6 +665,127 @@ gtk_text_layout_get_cursor_visible (GtkTextLayout *layout)
   return layout->cursor_visible;
 }
 
+/**
+ * gtk_text_layout_set_cache_rendering:
+ * @layout: a #GtkTextLayout
+ * @cache_rendering: whether to keep rendered paragraphs around
+ *
+ * Sets whether gtk_text_layout_draw() keeps a pixmap with the
+ * rendered contents of each cached paragraph, so that exposes which
+ * don't change the text, like blinking the cursor or scrolling, can
+ * be handled by copying the pixmap instead of laying out and
+ * rendering the text again. Paragraphs are rendered on top of the
+ * base color of the widget, so this should only be turned on when
+ * nothing else is drawn below the text.
+ *
+ * Since: 2.18
+ */
+void
+gtk_text_layout_set_cache_rendering (GtkTextLayout *layout,
+                                     gboolean       cache_rendering)
+{
+  GtkTextLayoutPrivate *priv;
+
+  g_return_if_fail (GTK_IS_TEXT_LAYOUT (layout));
+
+  priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  cache_rendering = (cache_rendering != FALSE);
+
+  if (priv->cache_rendering != cache_rendering)
+    {
+      GList *link;
+
+      priv->cache_rendering = cache_rendering;
+
+      for (link = priv->display_cache.head; link; link = link->next)
+        {
+          GtkTextLineDisplay *display = link->data;
+
+          _gtk_text_layout_drop_display_pixmap (layout, display);
+          display->pixmap_uncacheable = FALSE;
+        }
+    }
+}
+
+/**
+ * gtk_text_layout_get_cache_rendering:
+ * @layout: a #GtkTextLayout
+ *
+ * Returns whether rendered paragraphs are cached; see
+ * gtk_text_layout_set_cache_rendering().
+ *
+ * Return value: %TRUE if rendered paragraphs are cached
+ *
+ * Since: 2.18
+ */
+gboolean
+gtk_text_layout_get_cache_rendering (GtkTextLayout *layout)
+{
+  g_return_val_if_fail (GTK_IS_TEXT_LAYOUT (layout), FALSE);
+
+  return GTK_TEXT_LAYOUT_GET_PRIVATE (layout)->cache_rendering;
+}
+
+/* Makes room for a @width by @height pixmap on @display within the
+ * budget for cached pixmaps, dropping the pixmaps of the least
+ * recently used line displays as needed. Returns %FALSE if the
+ * pixmap would be too large to be cached at all.
+ */
+gboolean
+_gtk_text_layout_reserve_display_pixmap (GtkTextLayout      *layout,
+                                         GtkTextLineDisplay *display,
+                                         gint                width,
+                                         gint                height)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  gsize area;
+  GList *link;
+
+  g_return_val_if_fail (display->pixmap == NULL, FALSE);
+
+  if (width <= 0 || height <= 0)
+    return FALSE;
+
+  area = (gsize) width * height;
+  if (area > MAX_CACHED_PIXMAP_AREA)
+    return FALSE;
+
+  link = priv->display_cache.tail;
+  while (link && priv->pixmap_area + area > MAX_CACHED_PIXMAP_AREA)
+    {
+      GtkTextLineDisplay *oldest = link->data;
+
+      link = link->prev;
+
+      if (oldest != display)
+        _gtk_text_layout_drop_display_pixmap (layout, oldest);
+    }
+
+  priv->pixmap_area += area;
+
+  return TRUE;
+}
+
+/* Releases the pixmap of @display, if any, and its share of the
+ * budget for cached pixmaps.
+ */
+void
+_gtk_text_layout_drop_display_pixmap (GtkTextLayout      *layout,
+                                      GtkTextLineDisplay *display)
+{
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  gint width, height;
+
+  if (!display->pixmap)
+    return;
+
+  gdk_drawable_get_size (display->pixmap, &width, &height);
+  priv->pixmap_area -= (gsize) width * height;
+
+  g_object_unref (display->pixmap);
+  display->pixmap = NULL;
+}
+
 /**
  * gtk_text_layout_set_preedit_string:
  * @layout: a #PangoLayout
@@ -635,18 +868,63 @@ text_layout_changed (GtkTextLayout *layout,
                      gint           new_height,
                      gboolean       cursors_only)
 {
-  /* Check if the range intersects our cached line display,
-   * and invalidate the cached line if so.
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  GtkTextBTree *btree;
+  GtkTextLine *line;
+  gint line_top;
+  guint n_lines, n_cached;
+
+  /* Check if the range intersects our cached line displays, and
+   * invalidate the cached lines if so. Usually the range covers a
+   * line or two, so walk the lines in it and look them up in the
+   * cache; only when it covers more lines than there are cached
+   * displays is it cheaper to check every display instead.
    */
-  if (layout->one_display_cache)
+  n_cached = priv->display_cache.length;
+  if (n_cached == 0)
+    {
+      gtk_text_layout_emit_changed (layout, y, old_height, new_height);
+      return;
+    }
+
+  btree = _gtk_text_buffer_get_btree (layout->buffer);
+  line = _gtk_text_btree_find_line_by_y (btree, layout, y, &line_top);
+
+  for (n_lines = 0; line && line_top < y + old_height; n_lines++)
+    {
+      GtkTextLineData *line_data;
+      GList *link;
+
+      if (n_lines == n_cached)
+        break;
+
+      link = g_hash_table_lookup (priv->display_cache_index, line);
+      if (link && line_top + ((GtkTextLineDisplay *) link->data)->height > y)
+        gtk_text_layout_invalidate_cache (layout, line, cursors_only);
+
+      line_data = _gtk_text_line_get_data (line, layout);
+      line_top += line_data ? line_data->height : 0;
+      line = _gtk_text_line_next_excluding_last (line);
+    }
+
+  if (n_lines == n_cached && line && line_top < y + old_height)
     {
-      GtkTextLine *line = layout->one_display_cache->line;
-      gint cache_y = _gtk_text_btree_find_line_top (_gtk_text_buffer_get_btree (layout->buffer),
-						    line, layout);
-      gint cache_height = layout->one_display_cache->height;
+      GSList *lines = NULL;
+      GSList *tmp_list;
+      GList *link;
+
+      for (link = priv->display_cache.head; link; link = link->next)
+        {
+          GtkTextLineDisplay *display = link->data;
+          gint cache_y = _gtk_text_btree_find_line_top (btree, display->line, layout);
+
+          if (cache_y + display->height > y && cache_y < y + old_height)
+            lines = g_slist_prepend (lines, display->line);
+        }
 
-      if (cache_y + cache_height > y && cache_y < y + old_height)
-	gtk_text_layout_invalidate_cache (layout, line, cursors_only);
+      for (tmp_list = lines; tmp_list; tmp_list = tmp_list->next)
+        gtk_text_layout_invalidate_cache (layout, tmp_list->data, cursors_only);
+      g_slist_free (lines);
     }
 
   gtk_text_layout_emit_changed (layout, y, old_height, new_height);
@@ -812,9 +1090,13 @@ gtk_text_layout_invalidate_cache (GtkTextLayout *layout,
                                   GtkTextLine   *line,
 				  gboolean       cursors_only)
 {
-  if (layout->one_display_cache && line == layout->one_display_cache->line)
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  GList *link;
+
+  link = g_hash_table_lookup (priv->display_cache_index, line);
+  if (link)
     {
-      GtkTextLineDisplay *display = layout->one_display_cache;
+      GtkTextLineDisplay *display = link->data;
 
       if (cursors_only)
 	{
@@ -825,10 +1107,7 @@ gtk_text_layout_invalidate_cache (GtkTextLayout *layout,
 	  display->has_block_cursor = FALSE;
 	}
       else
-	{
-	  layout->one_display_cache = NULL;
-	  gtk_text_layout_free_line_display (layout, display);
-	}
+	display_cache_remove (layout, line);
     }
 }
 
@@ -920,32 +1199,52 @@ gtk_text_layout_real_invalidate_cursors (GtkTextLayout     *layout,
 					 const GtkTextIter *start,
 					 const GtkTextIter *end)
 {
-  /* Check if the range intersects our cached line display,
-   * and invalidate the cached line if so.
+  GtkTextLayoutPrivate *priv = GTK_TEXT_LAYOUT_GET_PRIVATE (layout);
+  GtkTextLine *line;
+  GtkTextLine *last_line;
+
+  if (gtk_text_iter_compare (start, end) > 0)
+    {
+      const GtkTextIter *tmp = start;
+      start = end;
+      end = tmp;
+    }
+
+  /* The cached line displays intersecting the range are those for
+   * the lines from the one of start to the one of end. Only the
+   * cursors are invalidated, so the cache itself isn't modified.
+   * Look the lines up one by one, unless the range covers more
+   * lines than there are cached displays.
    */
-  if (layout->one_display_cache)
+  if (gtk_text_iter_get_line (end) - gtk_text_iter_get_line (start) <
+      (gint) priv->display_cache.length)
     {
-      GtkTextIter line_start, line_end;
-      GtkTextLine *line = layout->one_display_cache->line;
+      line = _gtk_text_iter_get_text_line (start);
+      last_line = _gtk_text_iter_get_text_line (end);
 
-      _gtk_text_btree_get_iter_at_line (_gtk_text_buffer_get_btree (layout->buffer),
-                                        &line_start, line, 0);
-      line_end = line_start;
-      if (!gtk_text_iter_ends_line (&line_end))
-	gtk_text_iter_forward_to_line_end (&line_end);
+      while (TRUE)
+        {
+          gtk_text_layout_invalidate_cache (layout, line, TRUE);
 
-      if (gtk_text_iter_compare (start, end) > 0)
-	{
-	  const GtkTextIter *tmp = start;
-	  start = end;
-	  end = tmp;
-	}
+          if (line == last_line)
+            break;
 
-      if (gtk_text_iter_compare (&line_start, end) <= 0 &&
-	  gtk_text_iter_compare (start, &line_end) <= 0)
-	{
-	  gtk_text_layout_invalidate_cache (layout, line, TRUE);
-	}
+          line = _gtk_text_line_next_excluding_last (line);
+        }
+    }
+  else
+    {
+      GList *link;
+
+      for (link = priv->display_cache.head; link; link = link->next)
+        {
+          GtkTextLineDisplay *display = link->data;
+          gint line_number = _gtk_text_line_get_number (display->line);
+
+          if (line_number >= gtk_text_iter_get_line (start) &&
+              line_number <= gtk_text_iter_get_line (end))
+            gtk_text_layout_invalidate_cache (layout, display->line, TRUE);
+        }
     }
 
   gtk_text_layout_invalidated (layout);
@@ -1158,6 +1457,7 @@ gtk_text_layout_real_wrap (GtkTextLayout   *layout,
   line_data->width = display->width;
   line_data->height = display->height;
   line_data->valid = TRUE;
+
   gtk_text_layout_free_line_display (layout, display);
 
   return line_data;
@@ -2149,24 +2449,20 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
   
   g_return_val_if_fail (line != NULL, NULL);
 
-  if (layout->one_display_cache)
+  display = display_cache_lookup (layout, line);
+  if (display)
     {
-      if (line == layout->one_display_cache->line &&
-          (size_only || !layout->one_display_cache->size_only))
+      if (size_only || !display->size_only)
 	{
 	  if (!size_only)
-            update_text_display_cursors (layout, line, layout->one_display_cache);
-	  return layout->one_display_cache;
+            update_text_display_cursors (layout, line, display);
+	  return display;
 	}
       else
-        {
-          GtkTextLineDisplay *tmp_display = layout->one_display_cache;
-          layout->one_display_cache = NULL;
-          gtk_text_layout_free_line_display (layout, tmp_display);
-        }
+        display_cache_remove (layout, line);
     }
 
-  DV (g_print ("creating one line display cache (%s)\n", G_STRLOC));
+  DV (g_print ("creating line display (%s)\n", G_STRLOC));
 
   display = g_new0 (GtkTextLineDisplay, 1);
 
@@ -2488,7 +2784,12 @@ gtk_text_layout_get_line_display (GtkTextLayout *layout,
   if (tags != NULL)
     g_ptr_array_free (tags, TRUE);
 
-  layout->one_display_cache = display;
+  /* A size-only display can't be used for drawing; don't let the
+   * lines measured by background validation push the lines on screen
+   * out of the display cache. The caller frees it.
+   */
+  if (!size_only)
+    display_cache_insert (layout, display);
 
   if (saw_widget)
     allocate_child_widgets (layout, display);
@@ -2500,7 +2801,7 @@ void
 gtk_text_layout_free_line_display (GtkTextLayout      *layout,
                                    GtkTextLineDisplay *display)
 {
-  if (display != layout->one_display_cache)
+  if (!display_cache_contains (layout, display))
     {
       if (display->layout)
         g_object_unref (display->layout);
@@ -2515,6 +2816,8 @@ gtk_text_layout_free_line_display (GtkTextLayout      *layout,
       if (display->pg_bg_color)
         gdk_color_free (display->pg_bg_color);
 
+      _gtk_text_layout_drop_display_pixmap (layout, display);
+
       g_free (display);
     }
 }
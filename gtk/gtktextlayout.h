@@ -146,8 +146,8 @@ struct _GtkTextLayout
    * over long runs with the same style. */
   GtkTextAttributes *one_style_cache;
 
-  /* A cache of one line display. Getting the same line
-   * many times in a row is the most common case.
+  /* Unused; line displays are now cached in an LRU
+   * kept in the private data. Kept for ABI compatibility.
    */
   GtkTextLineDisplay *one_display_cache;
 
@@ -263,6 +263,17 @@ struct _GtkTextLineDisplay
   guint cursors_invalid : 1;
   guint has_block_cursor : 1;
   guint cursor_at_line_end : 1;
+  guint pixmap_uncacheable : 1;
+  guint pixmap_has_focus : 1;
+  guint pixmap_state : 3;
+
+  /* Rendered copy of the paragraph, kept when the layout caches
+   * rendering; see gtk_text_layout_set_cache_rendering(). It is only
+   * valid for the selection and widget state it was drawn with.
+   */
+  GdkPixmap *pixmap;
+  gint pixmap_selection_start;
+  gint pixmap_selection_end;
 };
 
 extern PangoAttrType gtk_text_attr_appearance_type;
@@ -297,6 +308,10 @@ void     gtk_text_layout_set_cursor_visible (GtkTextLayout     *layout,
                                              gboolean           cursor_visible);
 gboolean gtk_text_layout_get_cursor_visible (GtkTextLayout     *layout);
 
+void     gtk_text_layout_set_cache_rendering (GtkTextLayout     *layout,
+                                              gboolean           cache_rendering);
+gboolean gtk_text_layout_get_cache_rendering (GtkTextLayout     *layout);
+
 /* Getting the size or the lines potentially results in a call to
  * recompute, which is pretty massively expensive. Thus it should
  * basically only be done in an idle handler.
@@ -386,6 +401,12 @@ void     gtk_text_layout_get_cursor_locations (GtkTextLayout     *layout,
                                                GtkTextIter       *iter,
                                                GdkRectangle      *strong_pos,
                                                GdkRectangle      *weak_pos);
+gboolean _gtk_text_layout_reserve_display_pixmap (GtkTextLayout      *layout,
+                                                  GtkTextLineDisplay *display,
+                                                  gint                width,
+                                                  gint                height);
+void     _gtk_text_layout_drop_display_pixmap    (GtkTextLayout      *layout,
+                                                  GtkTextLineDisplay *display);
 gboolean _gtk_text_layout_get_block_cursor    (GtkTextLayout     *layout,
 					       GdkRectangle      *pos);
 gboolean gtk_text_layout_clamp_iter_to_vrange (GtkTextLayout     *layout,
@@ -296,7 +296,8 @@ char_segment_split_func (GtkTextLineSegment *seg, int index)
  * char_segment_cleanup_func --
  *
  *      This procedure merges adjacent character segments into
- *      a single character segment, if possible.
+ *      a single character segment, if possible and the result
+ *      is no longer than GTK_TEXT_CHAR_SEGMENT_MAX_BYTES.
  *
  * Arguments:
  *      segPtr: Pointer to the first of two adjacent segments to
@@ -328,6 +329,11 @@ char_segment_cleanup_func (GtkTextLineSegment *segPtr, GtkTextLine *line)
       return segPtr;
     }
 
+  if (segPtr->byte_count + segPtr2->byte_count > GTK_TEXT_CHAR_SEGMENT_MAX_BYTES)
+    {
+      return segPtr;
+    }
+
   newPtr =
     _gtk_char_segment_new_from_two_strings (segPtr->body.chars, 
 					    segPtr->byte_count,
@@ -406,7 +412,8 @@ char_segment_check_func (GtkTextLineSegment *segPtr, GtkTextLine *line)
 
   if (segPtr->next != NULL)
     {
-      if (segPtr->next->type == &gtk_text_char_type)
+      if (segPtr->next->type == &gtk_text_char_type &&
+          segPtr->byte_count + segPtr->next->byte_count <= GTK_TEXT_CHAR_SEGMENT_MAX_BYTES)
         {
           g_error ("adjacent character segments weren't merged");
         }
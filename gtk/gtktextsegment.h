@@ -152,6 +152,13 @@ struct _GtkTextLineSegment {
 };
 
 
+/* Character segments are not merged beyond this many bytes, so that
+ * splitting a segment or converting offsets within it stays cheap
+ * even for very long lines; a line is then a list of chunks with
+ * cached byte and char counts.
+ */
+#define GTK_TEXT_CHAR_SEGMENT_MAX_BYTES 4096
+
 GtkTextLineSegment  *gtk_text_line_segment_split (const GtkTextIter *iter);
 
 GtkTextLineSegment *_gtk_char_segment_new                  (const gchar    *text,
@@ -100,6 +100,9 @@
 
 #define SPACE_FOR_CURSOR 1
 
+/* How long incremental validation may run in one idle */
+#define GTK_TEXT_VIEW_VALIDATE_TIME_MS_PER_IDLE 15
+
 typedef struct _GtkTextViewPrivate GtkTextViewPrivate;
 
 #define GTK_TEXT_VIEW_GET_PRIVATE(obj) (G_TYPE_INSTANCE_GET_PRIVATE ((obj), GTK_TYPE_TEXT_VIEW, GtkTextViewPrivate))
@@ -109,6 +112,7 @@ struct _GtkTextViewPrivate
   guint blink_time;  /* time in msec the cursor has blinked since last user event */
   guint im_spot_idle;
   gchar *im_module;
+  guint cache_rendering : 1;
 };
 
 
@@ -158,7 +162,8 @@ enum
   PROP_BUFFER,
   PROP_OVERWRITE,
   PROP_ACCEPTS_TAB,
-  PROP_IM_MODULE
+  PROP_IM_MODULE,
+  PROP_CACHE_RENDERING
 };
 
 static void gtk_text_view_destroy              (GtkObject        *object);
@@ -683,6 +688,23 @@ gtk_text_view_class_init (GtkTextViewClass *klass)
                                                          NULL,
                                                          GTK_PARAM_READWRITE));
 
+  /**
+   * GtkTextView:cache-rendering:
+   *
+   * Whether rendered paragraphs are kept around so that they can
+   * be redrawn without laying out the text again. See
+   * gtk_text_view_set_cache_rendering().
+   *
+   * Since: 2.18
+   */
+  g_object_class_install_property (gobject_class,
+                                   PROP_CACHE_RENDERING,
+                                   g_param_spec_boolean ("cache-rendering",
+                                                         P_("Cache rendering"),
+                                                         P_("Whether rendered paragraphs are kept for redrawing"),
+                                                         FALSE,
+                                                         GTK_PARAM_READWRITE));
+
   /*
    * Style properties
    */
@@ -2985,6 +3007,10 @@ gtk_text_view_set_property (GObject         *object,
         gtk_im_multicontext_set_context_id (GTK_IM_MULTICONTEXT (text_view->im_context), priv->im_module);
       break;
 
+    case PROP_CACHE_RENDERING:
+      gtk_text_view_set_cache_rendering (text_view, g_value_get_boolean (value));
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3065,6 +3091,10 @@ gtk_text_view_get_property (GObject         *object,
       g_value_set_string (value, priv->im_module);
       break;
 
+    case PROP_CACHE_RENDERING:
+      g_value_set_boolean (value, priv->cache_rendering);
+      break;
+
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -3584,10 +3614,20 @@ incremental_validate_callback (gpointer data)
 {
   GtkTextView *text_view = data;
   gboolean result = TRUE;
+  GTimer *timer;
 
   DV(g_print(G_STRLOC"\n"));
-  
-  gtk_text_layout_validate (text_view->layout, 2000);
+
+  /* Keep validating while we are within our time slice, so that
+   * fast machines get the scroll geometry of a large buffer right
+   * quickly, while input still gets handled between slices.
+   */
+  timer = g_timer_new ();
+  do
+    gtk_text_layout_validate (text_view->layout, 2000);
+  while (g_timer_elapsed (timer, NULL) < GTK_TEXT_VIEW_VALIDATE_TIME_MS_PER_IDLE / 1000. &&
+         !gtk_text_layout_is_valid (text_view->layout));
+  g_timer_destroy (timer);
 
   gtk_text_view_update_adjustments (text_view);
   
@@ -5848,6 +5888,65 @@ gtk_text_view_get_accepts_tab (GtkTextView *text_view)
   return text_view->accepts_tab;
 }
 
+/**
+ * gtk_text_view_set_cache_rendering:
+ * @text_view: A #GtkTextView
+ * @cache_rendering: whether to keep rendered paragraphs around
+ *
+ * Sets whether @text_view keeps a rendered copy of the paragraphs
+ * it has drawn, so that redrawing them when the text hasn't
+ * changed, for instance when the cursor blinks, doesn't require
+ * laying out and rendering the text again. The copies are limited
+ * to a fixed amount of memory.
+ *
+ * Paragraphs are rendered on top of the base color of the widget,
+ * so this should only be turned on when nothing else is drawn
+ * below the text.
+ *
+ * Since: 2.18
+ **/
+void
+gtk_text_view_set_cache_rendering (GtkTextView *text_view,
+                                   gboolean     cache_rendering)
+{
+  GtkTextViewPrivate *priv;
+
+  g_return_if_fail (GTK_IS_TEXT_VIEW (text_view));
+
+  priv = GTK_TEXT_VIEW_GET_PRIVATE (text_view);
+  cache_rendering = cache_rendering != FALSE;
+
+  if (priv->cache_rendering != cache_rendering)
+    {
+      priv->cache_rendering = cache_rendering;
+
+      if (text_view->layout)
+        gtk_text_layout_set_cache_rendering (text_view->layout,
+                                             cache_rendering);
+
+      g_object_notify (G_OBJECT (text_view), "cache-rendering");
+    }
+}
+
+/**
+ * gtk_text_view_get_cache_rendering:
+ * @text_view: A #GtkTextView
+ *
+ * Returns whether rendered paragraphs are kept around; see
+ * gtk_text_view_set_cache_rendering().
+ *
+ * Return value: %TRUE if rendered paragraphs are cached
+ *
+ * Since: 2.18
+ **/
+gboolean
+gtk_text_view_get_cache_rendering (GtkTextView *text_view)
+{
+  g_return_val_if_fail (GTK_IS_TEXT_VIEW (text_view), FALSE);
+
+  return GTK_TEXT_VIEW_GET_PRIVATE (text_view)->cache_rendering;
+}
+
 static void
 gtk_text_view_compat_move_focus (GtkTextView     *text_view,
                                  GtkDirectionType direction_type)
@@ -6359,6 +6458,9 @@ gtk_text_view_ensure_layout (GtkTextView *text_view)
       gtk_text_layout_set_overwrite_mode (text_view->layout,
 					  text_view->overwrite_mode && text_view->editable);
 
+      gtk_text_layout_set_cache_rendering (text_view->layout,
+                                           GTK_TEXT_VIEW_GET_PRIVATE (text_view)->cache_rendering);
+
       ltr_context = gtk_widget_create_pango_context (GTK_WIDGET (text_view));
       pango_context_set_base_dir (ltr_context, PANGO_DIRECTION_LTR);
       rtl_context = gtk_widget_create_pango_context (GTK_WIDGET (text_view));
@@ -250,6 +250,110 @@ _gtk_tree_data_list_value_to_node (GtkTreeDataList *list,
     }
 }
 
+/* Whether @model uses the get_value() implementation of @store_type,
+ * i.e. whether its data can be read from the data list directly.
+ */
+static gboolean
+model_has_native_get_value (GtkTreeModel *model,
+			    GType         store_type)
+{
+  GtkTreeModelIface *iface;
+  GtkTreeModelIface *store_iface;
+
+  iface = GTK_TREE_MODEL_GET_IFACE (model);
+  store_iface = g_type_interface_peek (g_type_class_peek (store_type),
+				       GTK_TYPE_TREE_MODEL);
+
+  return iface->get_value == store_iface->get_value;
+}
+
+/* Gives direct access to the cell data of GtkListStore and GtkTreeStore,
+ * also when wrapped in a GtkTreeModelSort.  On success, @data is set to
+ * the stored string or object pointer, which stays owned by the model,
+ * or to a GINT_TO_POINTER() value for booleans, enums and integers.
+ * Returns %FALSE for other models and other column types, in which
+ * case gtk_tree_model_get_value() has to be used.
+ */
+gboolean
+_gtk_tree_data_list_peek_value (GtkTreeModel  *model,
+				GtkTreeIter   *iter,
+				gint           column,
+				GType         *type,
+				gconstpointer *data)
+{
+  GtkTreeDataList *list;
+  GType column_type;
+
+  if (GTK_IS_LIST_STORE (model))
+    {
+      GtkListStore *list_store = (GtkListStore *) model;
+
+      if (iter->stamp != list_store->stamp ||
+	  column < 0 || column >= list_store->n_columns ||
+	  !model_has_native_get_value (model, GTK_TYPE_LIST_STORE))
+	return FALSE;
+
+      list = g_sequence_get (iter->user_data);
+      column_type = list_store->column_headers[column];
+    }
+  else if (GTK_IS_TREE_STORE (model))
+    {
+      GtkTreeStore *tree_store = (GtkTreeStore *) model;
+
+      if (iter->stamp != tree_store->stamp ||
+	  column < 0 || column >= tree_store->n_columns ||
+	  !model_has_native_get_value (model, GTK_TYPE_TREE_STORE))
+	return FALSE;
+
+      list = G_NODE (iter->user_data)->data;
+      column_type = tree_store->column_headers[column];
+    }
+  else if (GTK_IS_TREE_MODEL_SORT (model))
+    {
+      GtkTreeModelSort *tree_model_sort = (GtkTreeModelSort *) model;
+      GtkTreeIter child_iter;
+
+      if (iter->stamp != tree_model_sort->stamp ||
+	  tree_model_sort->child_model == NULL ||
+	  !model_has_native_get_value (model, GTK_TYPE_TREE_MODEL_SORT))
+	return FALSE;
+
+      gtk_tree_model_sort_convert_iter_to_child_iter (tree_model_sort,
+						      &child_iter, iter);
+
+      return _gtk_tree_data_list_peek_value (tree_model_sort->child_model,
+					     &child_iter, column, type, data);
+    }
+  else
+    return FALSE;
+
+  while (column-- > 0 && list)
+    list = list->next;
+
+  switch (get_fundamental_type (column_type))
+    {
+    case G_TYPE_BOOLEAN:
+    case G_TYPE_INT:
+    case G_TYPE_ENUM:
+      *data = GINT_TO_POINTER (list ? list->data.v_int : 0);
+      break;
+    case G_TYPE_UINT:
+    case G_TYPE_FLAGS:
+      *data = GUINT_TO_POINTER (list ? list->data.v_uint : 0);
+      break;
+    case G_TYPE_STRING:
+    case G_TYPE_OBJECT:
+      *data = list ? list->data.v_pointer : NULL;
+      break;
+    default:
+      return FALSE;
+    }
+
+  *type = column_type;
+
+  return TRUE;
+}
+
 GtkTreeDataList *
 _gtk_tree_data_list_node_copy (GtkTreeDataList *list,
                                GType            type)
@@ -62,6 +62,11 @@ void             _gtk_tree_data_list_value_to_node  (GtkTreeDataList *list,
 
 GtkTreeDataList *_gtk_tree_data_list_node_copy      (GtkTreeDataList *list,
                                                      GType            type);
+gboolean         _gtk_tree_data_list_peek_value     (GtkTreeModel    *model,
+						     GtkTreeIter     *iter,
+						     gint             column,
+						     GType           *type,
+						     gconstpointer   *data);
 
 /* Header code */
 gint                   _gtk_tree_data_list_compare_func (GtkTreeModel *model,
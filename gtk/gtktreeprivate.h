@@ -274,6 +274,10 @@ struct _GtkTreeViewPrivate
   gint last_extra_space;
   gint last_extra_space_per_column;
   gint last_number_of_expand_columns;
+
+  /* Rendered rows, GtkRBNode -> GtkTreeViewRowCache */
+  GHashTable *row_cache;
+  guint row_cache_stamp;
 };
 
 #ifdef __GNUC__
@@ -396,6 +400,7 @@ void _gtk_tree_view_column_start_editing (GtkTreeViewColumn *tree_column,
 					  GtkCellEditable   *editable_widget);
 void _gtk_tree_view_column_stop_editing  (GtkTreeViewColumn *tree_column);
 void _gtk_tree_view_install_mark_rows_col_dirty (GtkTreeView *tree_view);
+void _gtk_tree_view_invalidate_row_cache        (GtkTreeView *tree_view);
 void             _gtk_tree_view_column_autosize          (GtkTreeView       *tree_view,
 							  GtkTreeViewColumn *column);
 
@@ -440,6 +445,23 @@ void              _gtk_tree_view_column_get_neighbor_sizes (GtkTreeViewColumn *c
 							    gint              *left,
 							    gint              *right);
 
+/* Typed attribute setters.  A cell renderer can install a setter for
+ * one of its properties; GtkTreeViewColumn then sets attributes mapped
+ * to GtkListStore or GtkTreeStore columns by passing the stored data
+ * straight to the setter, without a GValue and without emitting
+ * notification.  @data is the pointer itself for strings and objects,
+ * and a GINT_TO_POINTER() value for booleans and integers.
+ */
+typedef void (* GtkCellRendererAttributeSetter) (GtkCellRenderer *cell,
+						 gconstpointer    data);
+
+void     _gtk_cell_renderer_class_install_attribute_setter (GtkCellRendererClass           *cell_class,
+							    const gchar                    *property,
+							    GtkCellRendererAttributeSetter  setter);
+GtkCellRendererAttributeSetter
+         _gtk_cell_renderer_get_attribute_setter           (GtkCellRenderer                *cell,
+							    GParamSpec                     *pspec);
+
 
 G_END_DECLS
 
@@ -54,6 +54,12 @@
 #define GTK_TREE_VIEW_SEARCH_DIALOG_TIMEOUT 5000
 #define AUTO_EXPAND_TIMEOUT 500
 
+/* Limits for the rendered row cache; rows bigger than this are
+ * always drawn directly.
+ */
+#define ROW_CACHE_MAX_ROWS 512
+#define ROW_CACHE_MAX_ROW_PIXELS (4096 * 128)
+
 /* The "background" areas of all rows/cells add up to cover the entire tree.
  * The background includes all inter-row and inter-cell spacing.
  * The "cell" areas are the cell_area passed in to gtk_cell_renderer_render(),
@@ -88,6 +94,23 @@ struct _GtkTreeViewChild
 };
 
 
+/* A row rendered off-screen, with the state it was rendered in */
+typedef struct _GtkTreeViewRowCache GtkTreeViewRowCache;
+struct _GtkTreeViewRowCache
+{
+  GdkPixmap *pixmap;
+  gint width;
+  gint height;
+  guint stamp;
+  guint flags;
+  GtkStateType state;
+  guint is_cursor : 1;
+  guint has_focus : 1;
+  guint rtl : 1;
+  guint has_special_cell : 1;
+  guint is_separator : 1;
+};
+
 typedef struct _TreeViewDragInfo TreeViewDragInfo;
 struct _TreeViewDragInfo
 {
@@ -144,7 +167,8 @@ enum {
   PROP_RUBBER_BANDING,
   PROP_ENABLE_GRID_LINES,
   PROP_ENABLE_TREE_LINES,
-  PROP_TOOLTIP_COLUMN
+  PROP_TOOLTIP_COLUMN,
+  PROP_CACHE_ROWS
 };
 
 /* object signals */
@@ -387,6 +411,10 @@ static void     gtk_tree_view_real_set_cursor                (GtkTreeView
 							      gboolean            clear_and_select,
 							      gboolean            clamp_node);
 static gboolean gtk_tree_view_has_special_cell               (GtkTreeView        *tree_view);
+static void     gtk_tree_view_row_cache_free                 (GtkTreeViewRowCache *cached_row);
+static void     gtk_tree_view_clear_row_cache                (GtkTreeView        *tree_view);
+static void     gtk_tree_view_remove_cached_row              (GtkTreeView        *tree_view,
+							      GtkRBNode          *node);
 static void     column_sizing_notify                         (GObject            *object,
                                                               GParamSpec         *pspec,
                                                               gpointer            data);
@@ -773,6 +801,27 @@ gtk_tree_view_class_init (GtkTreeViewClass *class)
 						       -1,
 						       GTK_PARAM_READWRITE));
 
+    /**
+     * GtkTreeView:cache-rows:
+     *
+     * Whether rendered rows are kept off-screen, so that rows whose
+     * contents and state did not change can be redrawn without
+     * setting up and rendering their cells again.
+     *
+     * Only enable this if cell contents depend on nothing but the
+     * model, since rows are re-rendered only when the model emits
+     * #GtkTreeModel::row-changed for them.
+     *
+     * Since: 2.18
+     */
+    g_object_class_install_property (o_class,
+                                     PROP_CACHE_ROWS,
+                                     g_param_spec_boolean ("cache-rows",
+                                                           P_("Cache Rows"),
+                                                           P_("Whether rendered rows are cached off-screen"),
+                                                           FALSE,
+                                                           GTK_PARAM_READWRITE));
+
   /* Style properties */
 #define _TREE_VIEW_EXPANDER_SIZE 12
 #define _TREE_VIEW_VERTICAL_SEPARATOR 2
@@ -1457,6 +1506,9 @@ gtk_tree_view_set_property (GObject         *object,
     case PROP_TOOLTIP_COLUMN:
       gtk_tree_view_set_tooltip_column (tree_view, g_value_get_int (value));
       break;
+    case PROP_CACHE_ROWS:
+      gtk_tree_view_set_cache_rows (tree_view, g_value_get_boolean (value));
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1532,6 +1584,9 @@ gtk_tree_view_get_property (GObject    *object,
     case PROP_TOOLTIP_COLUMN:
       g_value_set_int (value, tree_view->priv->tooltip_column);
       break;
+    case PROP_CACHE_ROWS:
+      g_value_set_boolean (value, tree_view->priv->row_cache != NULL);
+      break;
     default:
       G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
       break;
@@ -1541,6 +1596,11 @@ gtk_tree_view_get_property (GObject    *object,
 static void
 gtk_tree_view_finalize (GObject *object)
 {
+  GtkTreeView *tree_view = GTK_TREE_VIEW (object);
+
+  if (tree_view->priv->row_cache)
+    g_hash_table_destroy (tree_view->priv->row_cache);
+
   G_OBJECT_CLASS (gtk_tree_view_parent_class)->finalize (object);
 }
 
@@ -1561,6 +1621,7 @@ gtk_tree_view_buildable_add_child (GtkBuildable *tree_view,
 static void
 gtk_tree_view_free_rbtree (GtkTreeView *tree_view)
 {
+  gtk_tree_view_clear_row_cache (tree_view);
   _gtk_rbtree_free (tree_view->priv->tree);
   
   tree_view->priv->tree = NULL;
@@ -1913,6 +1974,8 @@ gtk_tree_view_unrealize (GtkWidget *widget)
   for (list = priv->columns; list; list = list->next)
     _gtk_tree_view_column_unrealize_button (GTK_TREE_VIEW_COLUMN (list->data));
 
+  gtk_tree_view_clear_row_cache (tree_view);
+
   gdk_window_set_user_data (priv->bin_window, NULL);
   gdk_window_destroy (priv->bin_window);
   priv->bin_window = NULL;
@@ -2312,6 +2375,9 @@ gtk_tree_view_size_allocate_columns (GtkWidget *widget,
       if (column->width > old_width)
         column_changed = TRUE;
 
+      if (column->width != old_width)
+        _gtk_tree_view_invalidate_row_cache (tree_view);
+
       gtk_widget_size_allocate (column->button, &allocation);
 
       if (column->window)
@@ -4193,6 +4259,159 @@ gtk_tree_view_draw_grid_lines (GtkTreeView    *tree_view,
     }
 }
 
+/* Row cache
+ *
+ * When enabled, every row that is drawn is first rendered to a pixmap
+ * of its own, keyed by the rbtree node.  Later exposes of a row whose
+ * state did not change just copy the pixmap, without setting cell data
+ * or running the cell renderers.  Everything that depends on more than
+ * the row itself (grid and tree lines, expanders, focus, drop
+ * highlight) is still drawn directly on top.
+ *
+ * Entries are dropped when their row changes, and the whole cache is
+ * cleared whenever rbtree nodes may be freed.  Changes affecting all
+ * rows (column sizes, style, ...) only bump the stamp, so the pixmaps
+ * can be reused.
+ */
+static void
+gtk_tree_view_row_cache_free (GtkTreeViewRowCache *cached_row)
+{
+  if (cached_row->pixmap)
+    g_object_unref (cached_row->pixmap);
+
+  g_slice_free (GtkTreeViewRowCache, cached_row);
+}
+
+static void
+gtk_tree_view_clear_row_cache (GtkTreeView *tree_view)
+{
+  if (tree_view->priv->row_cache)
+    g_hash_table_remove_all (tree_view->priv->row_cache);
+}
+
+static void
+gtk_tree_view_remove_cached_row (GtkTreeView *tree_view,
+				 GtkRBNode   *node)
+{
+  if (tree_view->priv->row_cache)
+    g_hash_table_remove (tree_view->priv->row_cache, node);
+}
+
+void
+_gtk_tree_view_invalidate_row_cache (GtkTreeView *tree_view)
+{
+  tree_view->priv->row_cache_stamp++;
+}
+
+static gboolean
+gtk_tree_view_cached_row_matches (GtkTreeView         *tree_view,
+				  GtkTreeViewRowCache *cached_row,
+				  guint                flags,
+				  gboolean             is_cursor,
+				  gint                 width,
+				  gint                 height)
+{
+  GtkWidget *widget = GTK_WIDGET (tree_view);
+
+  return (cached_row != NULL &&
+	  cached_row->stamp == tree_view->priv->row_cache_stamp &&
+	  cached_row->flags == flags &&
+	  cached_row->is_cursor == (is_cursor != FALSE) &&
+	  cached_row->has_focus == (GTK_WIDGET_HAS_FOCUS (widget) != FALSE) &&
+	  cached_row->rtl == (gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL) &&
+	  cached_row->state == widget->state &&
+	  cached_row->width == width &&
+	  cached_row->height == height);
+}
+
+/* Sets up the cache entry for @node and returns the pixmap the row
+ * should be rendered to, or %NULL if the row is not to be cached.
+ */
+static GdkPixmap *
+gtk_tree_view_begin_cached_row (GtkTreeView *tree_view,
+				GtkRBNode   *node,
+				guint        flags,
+				gboolean     is_cursor,
+				gint         width,
+				gint         height,
+				gboolean     has_special_cell,
+				gboolean     is_separator)
+{
+  GtkWidget *widget = GTK_WIDGET (tree_view);
+  GtkTreeViewRowCache *cached_row;
+
+  if (width <= 0 || height <= 0 ||
+      width * height > ROW_CACHE_MAX_ROW_PIXELS)
+    {
+      gtk_tree_view_remove_cached_row (tree_view, node);
+      return NULL;
+    }
+
+  cached_row = g_hash_table_lookup (tree_view->priv->row_cache, node);
+
+  if (cached_row == NULL)
+    {
+      if (g_hash_table_size (tree_view->priv->row_cache) >= ROW_CACHE_MAX_ROWS)
+	gtk_tree_view_clear_row_cache (tree_view);
+
+      cached_row = g_slice_new0 (GtkTreeViewRowCache);
+      g_hash_table_insert (tree_view->priv->row_cache, node, cached_row);
+    }
+
+  if (cached_row->pixmap &&
+      (cached_row->width != width || cached_row->height != height))
+    {
+      g_object_unref (cached_row->pixmap);
+      cached_row->pixmap = NULL;
+    }
+
+  if (cached_row->pixmap == NULL)
+    cached_row->pixmap = gdk_pixmap_new (tree_view->priv->bin_window,
+					 width, height, -1);
+
+  cached_row->width = width;
+  cached_row->height = height;
+  cached_row->stamp = tree_view->priv->row_cache_stamp;
+  cached_row->flags = flags;
+  cached_row->state = widget->state;
+  cached_row->is_cursor = is_cursor != FALSE;
+  cached_row->has_focus = GTK_WIDGET_HAS_FOCUS (widget) != FALSE;
+  cached_row->rtl = gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL;
+  cached_row->has_special_cell = has_special_cell != FALSE;
+  cached_row->is_separator = is_separator != FALSE;
+
+  /* Themes may not paint every pixel of the cell backgrounds */
+  gdk_draw_rectangle (cached_row->pixmap,
+		      widget->style->base_gc[widget->state],
+		      TRUE,
+		      0, 0, width, height);
+
+  return cached_row->pixmap;
+}
+
+/* Copies the part of a cached row under @background_area to the
+ * window; @row_y is the window position of the row.
+ */
+static void
+gtk_tree_view_draw_cached_cell (GtkTreeView    *tree_view,
+				GdkEventExpose *event,
+				GdkPixmap      *pixmap,
+				gint            row_y,
+				GdkRectangle   *background_area)
+{
+  GdkRectangle area;
+
+  if (!gdk_rectangle_intersect (background_area, &event->area, &area))
+    return;
+
+  gdk_draw_drawable (event->window,
+		     GTK_WIDGET (tree_view)->style->fg_gc[GTK_STATE_NORMAL],
+		     pixmap,
+		     area.x, area.y - row_y,
+		     area.x, area.y,
+		     area.width, area.height);
+}
+
 /* Warning: Very scary function.
  * Modify at your own risk
  *
@@ -4234,6 +4453,7 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
   gboolean has_special_cell;
   gboolean rtl;
   gint n_visible_columns;
+  gint row_width;
   gint pointer_x, pointer_y;
   gint grid_line_width;
   gboolean got_pointer = FALSE;
@@ -4325,11 +4545,13 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
     gtk_widget_style_get (widget, "grid-line-width", &grid_line_width, NULL);
   
   n_visible_columns = 0;
+  row_width = 0;
   for (list = tree_view->priv->columns; list; list = list->next)
     {
       if (! GTK_TREE_VIEW_COLUMN (list->data)->visible)
 	continue;
       n_visible_columns ++;
+      row_width += GTK_TREE_VIEW_COLUMN (list->data)->width;
     }
 
   /* Find the last column */
@@ -4355,8 +4577,13 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
       gboolean is_separator = FALSE;
       gboolean is_first = FALSE;
       gboolean is_last = FALSE;
-      
-      is_separator = row_is_separator (tree_view, &iter, NULL);
+      gboolean use_cached_row = FALSE;
+      GtkTreeViewRowCache *cached_row = NULL;
+      GdkPixmap *row_pixmap = NULL;
+      GdkDrawable *drawable;
+      GdkRectangle *expose_area;
+      GdkRectangle row_area;
+      gint row_y;
 
       max_height = ROW_HEIGHT (tree_view, BACKGROUND_HEIGHT (node));
 
@@ -4377,23 +4604,72 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
 
       parity = _gtk_rbtree_node_find_parity (tree, node);
 
-      /* we *need* to set cell data on all cells before the call
-       * to _has_special_cell, else _has_special_cell() does not
-       * return a correct value.
-       */
-      for (list = (rtl ? g_list_last (tree_view->priv->columns) : g_list_first (tree_view->priv->columns));
-	   list;
-	   list = (rtl ? list->prev : list->next))
-        {
-	  GtkTreeViewColumn *column = list->data;
-	  gtk_tree_view_column_cell_set_cell_data (column,
-						   tree_view->priv->model,
-						   &iter,
-						   GTK_RBNODE_FLAG_SET (node, GTK_RBNODE_IS_PARENT),
-						   node->children?TRUE:FALSE);
-        }
+      if (tree_view->priv->row_cache)
+	{
+	  cached_row = g_hash_table_lookup (tree_view->priv->row_cache, node);
+	  use_cached_row = gtk_tree_view_cached_row_matches (tree_view, cached_row,
+							     flags, node == cursor,
+							     row_width, max_height);
+
+	  /* Focusing a single cell needs the cell data of the cursor row */
+	  if (use_cached_row && node == cursor && cached_row->has_special_cell)
+	    use_cached_row = FALSE;
+	}
+
+      if (use_cached_row)
+	{
+	  is_separator = cached_row->is_separator;
+	  has_special_cell = cached_row->has_special_cell;
+	}
+      else
+	{
+	  is_separator = row_is_separator (tree_view, &iter, NULL);
+
+	  /* we *need* to set cell data on all cells before the call
+	   * to _has_special_cell, else _has_special_cell() does not
+	   * return a correct value.
+	   */
+	  for (list = (rtl ? g_list_last (tree_view->priv->columns) : g_list_first (tree_view->priv->columns));
+	       list;
+	       list = (rtl ? list->prev : list->next))
+	    {
+	      GtkTreeViewColumn *column = list->data;
+	      gtk_tree_view_column_cell_set_cell_data (column,
+						       tree_view->priv->model,
+						       &iter,
+						       GTK_RBNODE_FLAG_SET (node, GTK_RBNODE_IS_PARENT),
+						       node->children?TRUE:FALSE);
+	    }
+
+	  has_special_cell = gtk_tree_view_has_special_cell (tree_view);
 
-      has_special_cell = gtk_tree_view_has_special_cell (tree_view);
+	  if (tree_view->priv->row_cache)
+	    row_pixmap = gtk_tree_view_begin_cached_row (tree_view, node,
+							 flags, node == cursor,
+							 row_width, max_height,
+							 has_special_cell,
+							 is_separator);
+	}
+
+      /* Rows that go to the cache are rendered in full, in the
+       * coordinates of the row pixmap, and then copied to the window.
+       */
+      if (row_pixmap)
+	{
+	  drawable = row_pixmap;
+	  row_y = background_area.y;
+	  row_area.x = 0;
+	  row_area.y = 0;
+	  row_area.width = row_width;
+	  row_area.height = max_height;
+	  expose_area = &row_area;
+	}
+      else
+	{
+	  drawable = event->window;
+	  row_y = use_cached_row ? background_area.y : 0;
+	  expose_area = &event->area;
+	}
 
       for (list = (rtl ? g_list_last (tree_view->priv->columns) : g_list_first (tree_view->priv->columns));
 	   list;
@@ -4401,13 +4677,15 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
 	{
 	  GtkTreeViewColumn *column = list->data;
 	  const gchar *detail = NULL;
+	  gchar new_detail[128];
 	  GtkStateType state;
 
 	  if (!column->visible)
             continue;
 
-	  if (cell_offset > event->area.x + event->area.width ||
-	      cell_offset + column->width < event->area.x)
+	  if (!row_pixmap &&
+	      (cell_offset > event->area.x + event->area.width ||
+	       cell_offset + column->width < event->area.x))
 	    {
 	      cell_offset += column->width;
 	      continue;
@@ -4456,17 +4734,19 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
 	      cell_area.height -= grid_line_width;
 	    }
 
-	  if (gdk_region_rect_in (event->region, &background_area) == GDK_OVERLAP_RECTANGLE_OUT)
+	  if (!row_pixmap &&
+	      gdk_region_rect_in (event->region, &background_area) == GDK_OVERLAP_RECTANGLE_OUT)
 	    {
 	      cell_offset += column->width;
 	      continue;
 	    }
 
-	  gtk_tree_view_column_cell_set_cell_data (column,
-						   tree_view->priv->model,
-						   &iter,
-						   GTK_RBNODE_FLAG_SET (node, GTK_RBNODE_IS_PARENT),
-						   node->children?TRUE:FALSE);
+	  if (!use_cached_row)
+	    gtk_tree_view_column_cell_set_cell_data (column,
+						     tree_view->priv->model,
+						     &iter,
+						     GTK_RBNODE_FLAG_SET (node, GTK_RBNODE_IS_PARENT),
+						     node->children?TRUE:FALSE);
 
           /* Select the detail for drawing the cell.  relevant
            * factors are parity, sortedness, and whether to
@@ -4518,11 +4798,8 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
 	  else
 	    state = GTK_STATE_NORMAL;
 
-	  /* Draw background */
 	  if (row_ending_details)
 	    {
-	      char new_detail[128];
-
 	      is_first = (rtl ? !list->next : !list->prev);
 	      is_last = (rtl ? !list->prev : !list->next);
 
@@ -4538,31 +4815,75 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
 	      else
 		g_snprintf (new_detail, 128, "%s_middle", detail);
 
-	      gtk_paint_flat_box (widget->style,
-				  event->window,
-				  state,
-				  GTK_SHADOW_NONE,
-				  &event->area,
-				  widget,
-				  new_detail,
-				  background_area.x,
-				  background_area.y,
-				  background_area.width,
-				  background_area.height);
+	      detail = new_detail;
 	    }
+
+	  if (gtk_tree_view_is_expander_column (tree_view, column))
+	    {
+	      if (!rtl)
+		cell_area.x += (depth - 1) * tree_view->priv->level_indentation;
+	      cell_area.width -= (depth - 1) * tree_view->priv->level_indentation;
+
+              if (TREE_VIEW_DRAW_EXPANDERS(tree_view))
+	        {
+	          if (!rtl)
+		    cell_area.x += depth * tree_view->priv->expander_size;
+		  cell_area.width -= depth * tree_view->priv->expander_size;
+		}
+
+              /* If we have an expander column, the highlight underline
+               * starts with that column, so that it indicates which
+               * level of the tree we're dropping at.
+               */
+              highlight_x = cell_area.x;
+	      expander_cell_width = cell_area.width;
+	    }
+
+	  /* Draw background and cell, unless the row cache has them */
+	  if (use_cached_row)
+	    gtk_tree_view_draw_cached_cell (tree_view, event, cached_row->pixmap,
+					    row_y, &background_area);
 	  else
 	    {
+	      GdkRectangle draw_background_area = background_area;
+	      GdkRectangle draw_cell_area = cell_area;
+
+	      draw_background_area.y -= row_y;
+	      draw_cell_area.y -= row_y;
+
 	      gtk_paint_flat_box (widget->style,
-				  event->window,
+				  drawable,
 				  state,
 				  GTK_SHADOW_NONE,
-				  &event->area,
+				  expose_area,
 				  widget,
 				  detail,
-				  background_area.x,
-				  background_area.y,
-				  background_area.width,
-				  background_area.height);
+				  draw_background_area.x,
+				  draw_background_area.y,
+				  draw_background_area.width,
+				  draw_background_area.height);
+
+	      if (is_separator)
+		gtk_paint_hline (widget->style,
+				 drawable,
+				 state,
+				 &draw_cell_area,
+				 widget,
+				 NULL,
+				 draw_cell_area.x,
+				 draw_cell_area.x + draw_cell_area.width,
+				 draw_cell_area.y + draw_cell_area.height / 2);
+	      else
+		_gtk_tree_view_column_cell_render (column,
+						   drawable,
+						   &draw_background_area,
+						   &draw_cell_area,
+						   expose_area,
+						   flags);
+
+	      if (row_pixmap)
+		gtk_tree_view_draw_cached_cell (tree_view, event, row_pixmap,
+						row_y, &background_area);
 	    }
 
 	  if (draw_hgrid_lines)
@@ -4654,79 +4975,23 @@ gtk_tree_view_bin_expose (GtkWidget      *widget,
 		}
 	    }
 
-	  if (gtk_tree_view_is_expander_column (tree_view, column))
+	  if (gtk_tree_view_is_expander_column (tree_view, column) &&
+	      TREE_VIEW_DRAW_EXPANDERS(tree_view) &&
+	      (node->flags & GTK_RBNODE_IS_PARENT) == GTK_RBNODE_IS_PARENT)
 	    {
-	      if (!rtl)
-		cell_area.x += (depth - 1) * tree_view->priv->level_indentation;
-	      cell_area.width -= (depth - 1) * tree_view->priv->level_indentation;
-
-              if (TREE_VIEW_DRAW_EXPANDERS(tree_view))
-	        {
-	          if (!rtl)
-		    cell_area.x += depth * tree_view->priv->expander_size;
-		  cell_area.width -= depth * tree_view->priv->expander_size;
-		}
-
-              /* If we have an expander column, the highlight underline
-               * starts with that column, so that it indicates which
-               * level of the tree we're dropping at.
-               */
-              highlight_x = cell_area.x;
-	      expander_cell_width = cell_area.width;
-
-	      if (is_separator)
-		gtk_paint_hline (widget->style,
-				 event->window,
-				 state,
-				 &cell_area,
-				 widget,
-				 NULL,
-				 cell_area.x,
-				 cell_area.x + cell_area.width,
-				 cell_area.y + cell_area.height / 2);
-	      else
-		_gtk_tree_view_column_cell_render (column,
-						   event->window,
-						   &background_area,
-						   &cell_area,
-						   &event->area,
-						   flags);
-	      if (TREE_VIEW_DRAW_EXPANDERS(tree_view)
-		  && (node->flags & GTK_RBNODE_IS_PARENT) == GTK_RBNODE_IS_PARENT)
+	      if (!got_pointer)
 		{
-		  if (!got_pointer)
-		    {
-		      gdk_window_get_pointer (tree_view->priv->bin_window, 
-					      &pointer_x, &pointer_y, NULL);
-		      got_pointer = TRUE;
-		    }
-
-		  gtk_tree_view_draw_arrow (GTK_TREE_VIEW (widget),
-					    tree,
-					    node,
-					    pointer_x, pointer_y);
+		  gdk_window_get_pointer (tree_view->priv->bin_window, 
+					  &pointer_x, &pointer_y, NULL);
+		  got_pointer = TRUE;
 		}
+
+	      gtk_tree_view_draw_arrow (GTK_TREE_VIEW (widget),
+					tree,
+					node,
+					pointer_x, pointer_y);
 	    }
-	  else
-	    {
-	      if (is_separator)
-		gtk_paint_hline (widget->style,
-				 event->window,
-				 state,
-				 &cell_area,
-				 widget,
-				 NULL,
-				 cell_area.x,
-				 cell_area.x + cell_area.width,
-				 cell_area.y + cell_area.height / 2);
-	      else
-		_gtk_tree_view_column_cell_render (column,
-						   event->window,
-						   &background_area,
-						   &cell_area,
-						   &event->area,
-						   flags);
-	    }
+
 	  if (node == cursor && has_special_cell &&
 	      ((column == tree_view->priv->focus_column &&
 		GTK_TREE_VIEW_FLAG_SET (tree_view, GTK_TREE_VIEW_DRAW_KEYFOCUS) &&
@@ -7922,6 +8187,8 @@ gtk_tree_view_style_set (GtkWidget *widget,
   GList *list;
   GtkTreeViewColumn *column;
 
+  _gtk_tree_view_invalidate_row_cache (tree_view);
+
   if (GTK_WIDGET_REALIZED (widget))
     {
       gdk_window_set_back_pixmap (widget->window, NULL, FALSE);
@@ -8203,6 +8470,8 @@ gtk_tree_view_row_changed (GtkTreeModel *model,
   if (tree == NULL)
     goto done;
 
+  gtk_tree_view_remove_cached_row (tree_view, node);
+
   if (tree_view->priv->fixed_height_mode
       && tree_view->priv->fixed_height >= 0)
     {
@@ -8320,6 +8589,9 @@ gtk_tree_view_row_inserted (GtkTreeModel *model,
       goto done;
     }
 
+  /* The parity of the following rows changes */
+  gtk_tree_view_clear_row_cache (tree_view);
+
   /* ref the node */
   gtk_tree_model_ref_node (tree_view->priv->model, iter);
   if (indices[depth - 1] == 0)
@@ -8397,6 +8669,8 @@ gtk_tree_view_row_has_child_toggled (GtkTreeModel *model,
   else
     GTK_RBNODE_UNSET_FLAG (node, GTK_RBNODE_IS_PARENT);
 
+  gtk_tree_view_remove_cached_row (tree_view, node);
+
   if (has_child && GTK_TREE_VIEW_FLAG_SET (tree_view, GTK_TREE_VIEW_IS_LIST))
     {
       GTK_TREE_VIEW_UNSET_FLAG (tree_view, GTK_TREE_VIEW_IS_LIST);
@@ -8479,6 +8753,7 @@ gtk_tree_view_row_deleted (GtkTreeModel *model,
 
   /* Ensure we don't have a dangling pointer to a dead node */
   ensure_unprelighted (tree_view);
+  gtk_tree_view_clear_row_cache (tree_view);
 
   /* Cancel editting if we've started */
   gtk_tree_view_stop_editing (tree_view, TRUE);
@@ -8565,6 +8840,8 @@ gtk_tree_view_rows_reordered (GtkTreeModel *model,
 
   /* clear the timeout */
   cancel_arrow_animation (tree_view);
+
+  gtk_tree_view_clear_row_cache (tree_view);
   
   _gtk_rbtree_reorder (tree, new_order, len);
 
@@ -11123,6 +11400,7 @@ gtk_tree_view_set_rules_hint (GtkTreeView  *tree_view,
   if (tree_view->priv->has_rules != setting)
     {
       tree_view->priv->has_rules = setting;
+      _gtk_tree_view_invalidate_row_cache (tree_view);
       gtk_widget_queue_draw (GTK_WIDGET (tree_view));
     }
 
@@ -11230,6 +11508,7 @@ gtk_tree_view_remove_column (GtkTreeView       *tree_view,
     }
 
   g_object_unref (column);
+  _gtk_tree_view_invalidate_row_cache (tree_view);
   g_signal_emit (tree_view, tree_view_signals[COLUMNS_CHANGED], 0);
 
   return tree_view->priv->n_columns;
@@ -11294,6 +11573,7 @@ gtk_tree_view_insert_column (GtkTreeView       *tree_view,
       gtk_widget_queue_resize (GTK_WIDGET (tree_view));
     }
 
+  _gtk_tree_view_invalidate_row_cache (tree_view);
   g_signal_emit (tree_view, tree_view_signals[COLUMNS_CHANGED], 0);
 
   return tree_view->priv->n_columns;
@@ -11495,6 +11775,7 @@ gtk_tree_view_move_column_after (GtkTreeView       *tree_view,
       gtk_tree_view_size_allocate_columns (GTK_WIDGET (tree_view), NULL);
     }
 
+  _gtk_tree_view_invalidate_row_cache (tree_view);
   g_signal_emit (tree_view, tree_view_signals[COLUMNS_CHANGED], 0);
 }
 
@@ -11532,6 +11813,7 @@ gtk_tree_view_set_expander_column (GtkTreeView       *tree_view,
 	}
 
       tree_view->priv->expander_column = column;
+      _gtk_tree_view_invalidate_row_cache (tree_view);
       g_object_notify (G_OBJECT (tree_view), "expander-column");
     }
 }
@@ -12094,6 +12376,8 @@ gtk_tree_view_real_expand_row (GtkTreeView *tree_view,
   if (expand)
     return FALSE;
 
+  gtk_tree_view_clear_row_cache (tree_view);
+
   node->children = _gtk_rbtree_new ();
   node->children->parent_tree = tree;
   node->children->parent_node = node;
@@ -12286,6 +12570,8 @@ gtk_tree_view_real_collapse_row (GtkTreeView *tree_view,
 
   remove_expand_collapse_timeout (tree_view);
 
+  gtk_tree_view_clear_row_cache (tree_view);
+
   if (gtk_tree_view_unref_and_check_selection_tree (tree_view, node->children))
     {
       _gtk_rbtree_remove (node->children);
@@ -15088,6 +15374,8 @@ gtk_tree_view_set_row_separator_func (GtkTreeView                 *tree_view,
   tree_view->priv->row_separator_func = func;
   tree_view->priv->row_separator_data = data;
   tree_view->priv->row_separator_destroy = destroy;
+
+  _gtk_tree_view_invalidate_row_cache (tree_view);
 }
 
   
@@ -15167,6 +15455,9 @@ gtk_tree_view_set_grid_lines (GtkTreeView           *tree_view,
 
   old_grid_lines = priv->grid_lines;
   priv->grid_lines = grid_lines;
+
+  if (grid_lines != old_grid_lines)
+    _gtk_tree_view_invalidate_row_cache (tree_view);
   
   if (GTK_WIDGET_REALIZED (widget))
     {
@@ -15326,7 +15617,10 @@ gtk_tree_view_set_show_expanders (GtkTreeView *tree_view,
     GTK_TREE_VIEW_UNSET_FLAG (tree_view, GTK_TREE_VIEW_SHOW_EXPANDERS);
 
   if (enabled != was_enabled)
-    gtk_widget_queue_draw (GTK_WIDGET (tree_view));
+    {
+      _gtk_tree_view_invalidate_row_cache (tree_view);
+      gtk_widget_queue_draw (GTK_WIDGET (tree_view));
+    }
 }
 
 /**
@@ -15367,6 +15661,7 @@ gtk_tree_view_set_level_indentation (GtkTreeView *tree_view,
 {
   tree_view->priv->level_indentation = indentation;
 
+  _gtk_tree_view_invalidate_row_cache (tree_view);
   gtk_widget_queue_draw (GTK_WIDGET (tree_view));
 }
 
@@ -15704,5 +15999,65 @@ gtk_tree_view_get_tooltip_column (GtkTreeView *tree_view)
   return tree_view->priv->tooltip_column;
 }
 
+/**
+ * gtk_tree_view_set_cache_rows:
+ * @tree_view: a #GtkTreeView
+ * @cache_rows: whether to cache rendered rows
+ *
+ * Sets whether @tree_view keeps rendered rows off-screen. With the
+ * cache enabled, moving the pointer or the cursor, or changing the
+ * selection, only re-renders the rows whose state changed; other rows
+ * are copied from the cache without calling the cell data functions
+ * or the cell renderers.
+ *
+ * A cached row is rendered again when the model emits
+ * #GtkTreeModel::row-changed for it, so this should only be enabled
+ * if the contents of the cells depend on nothing but the model.
+ *
+ * Since: 2.18
+ */
+void
+gtk_tree_view_set_cache_rows (GtkTreeView *tree_view,
+			      gboolean     cache_rows)
+{
+  g_return_if_fail (GTK_IS_TREE_VIEW (tree_view));
+
+  cache_rows = cache_rows != FALSE;
+
+  if (cache_rows == (tree_view->priv->row_cache != NULL))
+    return;
+
+  if (cache_rows)
+    tree_view->priv->row_cache =
+      g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL,
+			     (GDestroyNotify) gtk_tree_view_row_cache_free);
+  else
+    {
+      g_hash_table_destroy (tree_view->priv->row_cache);
+      tree_view->priv->row_cache = NULL;
+    }
+
+  g_object_notify (G_OBJECT (tree_view), "cache-rows");
+}
+
+/**
+ * gtk_tree_view_get_cache_rows:
+ * @tree_view: a #GtkTreeView
+ *
+ * Returns whether rendered rows are cached, see
+ * gtk_tree_view_set_cache_rows().
+ *
+ * Return value: %TRUE if rendered rows are cached
+ *
+ * Since: 2.18
+ */
+gboolean
+gtk_tree_view_get_cache_rows (GtkTreeView *tree_view)
+{
+  g_return_val_if_fail (GTK_IS_TREE_VIEW (tree_view), FALSE);
+
+  return tree_view->priv->row_cache != NULL;
+}
+
 #define __GTK_TREE_VIEW_C__
 #include "gtkaliasdef.c"
@@ -425,6 +425,10 @@ void          gtk_tree_view_set_tooltip_column (GtkTreeView       *tree_view,
 					        gint               column);
 gint          gtk_tree_view_get_tooltip_column (GtkTreeView       *tree_view);
 
+void          gtk_tree_view_set_cache_rows     (GtkTreeView       *tree_view,
+					        gboolean           cache_rows);
+gboolean      gtk_tree_view_get_cache_rows     (GtkTreeView       *tree_view);
+
 G_END_DECLS
 
 
@@ -22,6 +22,7 @@
 #include "gtktreeviewcolumn.h"
 #include "gtktreeview.h"
 #include "gtktreeprivate.h"
+#include "gtktreedatalist.h"
 #include "gtkcelllayout.h"
 #include "gtkbutton.h"
 #include "gtkalignment.h"
@@ -60,11 +61,23 @@ enum
   LAST_SIGNAL
 };
 
+/* An attribute resolved against its cell renderer */
+typedef struct _GtkTreeViewColumnBinding GtkTreeViewColumnBinding;
+struct _GtkTreeViewColumnBinding
+{
+  const gchar *attribute;
+  gint column;
+  GParamSpec *pspec;
+  GtkCellRendererAttributeSetter setter;
+};
+
 typedef struct _GtkTreeViewColumnCellInfo GtkTreeViewColumnCellInfo;
 struct _GtkTreeViewColumnCellInfo
 {
   GtkCellRenderer *cell;
   GSList *attributes;
+  GtkTreeViewColumnBinding *bindings;
+  gint n_bindings;
   GtkTreeCellDataFunc func;
   gpointer func_data;
   GDestroyNotify destroy;
@@ -690,6 +703,10 @@ gtk_tree_view_column_cell_layout_add_attribute (GtkCellLayout   *cell_layout,
   info->attributes = g_slist_prepend (info->attributes, GINT_TO_POINTER (column));
   info->attributes = g_slist_prepend (info->attributes, g_strdup (attribute));
 
+  g_free (info->bindings);
+  info->bindings = NULL;
+  info->n_bindings = 0;
+
   if (tree_column->tree_view)
     _gtk_tree_view_column_cell_set_dirty (tree_column, TRUE);
 }
@@ -785,6 +802,10 @@ gtk_tree_view_column_clear_attributes_by_info (GtkTreeViewColumn *tree_column,
   g_slist_free (info->attributes);
   info->attributes = NULL;
 
+  g_free (info->bindings);
+  info->bindings = NULL;
+  info->n_bindings = 0;
+
   if (tree_column->tree_view)
     _gtk_tree_view_column_cell_set_dirty (tree_column, TRUE);
 }
@@ -871,6 +892,10 @@ gtk_tree_view_column_update_button (GtkTreeViewColumn *tree_column)
   else
     model = NULL;
 
+  /* Visibility and the sort indicator change how rows are drawn */
+  if (tree_column->tree_view)
+    _gtk_tree_view_invalidate_row_cache (GTK_TREE_VIEW (tree_column->tree_view));
+
   /* Create a button if necessary */
   if (tree_column->visible &&
       tree_column->button == NULL &&
@@ -2501,6 +2526,37 @@ gtk_tree_view_column_get_sort_order      (GtkTreeViewColumn     *tree_column)
   return tree_column->sort_order;
 }
 
+/* Resolves the attributes of @info against its cell renderer, so that
+ * typed setters can be used where the renderer provides them.
+ */
+static void
+gtk_tree_view_column_bind_attributes (GtkTreeViewColumnCellInfo *info)
+{
+  GObjectClass *cell_class = G_OBJECT_GET_CLASS (info->cell);
+  GSList *list;
+  gint i;
+
+  info->n_bindings = g_slist_length (info->attributes) / 2;
+  info->bindings = g_new0 (GtkTreeViewColumnBinding, info->n_bindings);
+
+  for (list = info->attributes, i = 0;
+       list && list->next;
+       list = list->next->next, i++)
+    {
+      GtkTreeViewColumnBinding *binding = &info->bindings[i];
+
+      binding->attribute = list->data;
+      binding->column = GPOINTER_TO_INT (list->next->data);
+      binding->pspec = g_object_class_find_property (cell_class, binding->attribute);
+
+      if (binding->pspec &&
+	  (binding->pspec->flags & G_PARAM_WRITABLE) &&
+	  !(binding->pspec->flags & G_PARAM_CONSTRUCT_ONLY))
+	binding->setter = _gtk_cell_renderer_get_attribute_setter (info->cell,
+								   binding->pspec);
+    }
+}
+
 /**
  * gtk_tree_view_column_cell_set_cell_data:
  * @tree_column: A #GtkTreeViewColumn.
@@ -2521,7 +2577,7 @@ gtk_tree_view_column_cell_set_cell_data (GtkTreeViewColumn *tree_column,
 					 gboolean           is_expander,
 					 gboolean           is_expanded)
 {
-  GSList *list;
+  static guint notify_signal_id = 0;
   GValue value = { 0, };
   GList *cell_list;
 
@@ -2530,12 +2586,18 @@ gtk_tree_view_column_cell_set_cell_data (GtkTreeViewColumn *tree_column,
   if (tree_model == NULL)
     return;
 
+  if (!notify_signal_id)
+    notify_signal_id = g_signal_lookup ("notify", G_TYPE_OBJECT);
+
   for (cell_list = tree_column->cell_list; cell_list; cell_list = cell_list->next)
     {
       GtkTreeViewColumnCellInfo *info = (GtkTreeViewColumnCellInfo *) cell_list->data;
       GObject *cell = (GObject *) info->cell;
+      gboolean direct;
+      gint i;
 
-      list = info->attributes;
+      if (info->attributes && info->bindings == NULL)
+	gtk_tree_view_column_bind_attributes (info);
 
       g_object_freeze_notify (cell);
 
@@ -2545,14 +2607,32 @@ gtk_tree_view_column_cell_set_cell_data (GtkTreeViewColumn *tree_column,
       if (info->cell->is_expanded != is_expanded)
 	g_object_set (cell, "is-expanded", is_expanded, NULL);
 
-      while (list && list->next)
+      /* Typed setters don't emit notification, so only use them if
+       * nobody is listening.
+       */
+      direct = g_signal_handler_find (cell, G_SIGNAL_MATCH_ID, notify_signal_id,
+				      0, NULL, NULL, NULL) == 0;
+
+      for (i = 0; i < info->n_bindings; i++)
 	{
+	  GtkTreeViewColumnBinding *binding = &info->bindings[i];
+	  gconstpointer data;
+	  GType type;
+
+	  if (direct && binding->setter &&
+	      _gtk_tree_data_list_peek_value (tree_model, iter, binding->column,
+					      &type, &data) &&
+	      g_type_is_a (type, binding->pspec->value_type))
+	    {
+	      binding->setter (info->cell, data);
+	      continue;
+	    }
+
 	  gtk_tree_model_get_value (tree_model, iter,
-				    GPOINTER_TO_INT (list->next->data),
+				    binding->column,
 				    &value);
-	  g_object_set_property (cell, (gchar *) list->data, &value);
+	  g_object_set_property (cell, binding->attribute, &value);
 	  g_value_unset (&value);
-	  list = list->next->next;
 	}
 
       if (info->func)
@@ -3584,6 +3664,9 @@ _gtk_tree_view_column_cell_set_dirty (GtkTreeViewColumn *tree_column,
   tree_column->requested_width = -1;
   tree_column->width = 0;
 
+  if (tree_column->tree_view)
+    _gtk_tree_view_invalidate_row_cache (GTK_TREE_VIEW (tree_column->tree_view));
+
   if (tree_column->tree_view &&
       GTK_WIDGET_REALIZED (tree_column->tree_view))
     {
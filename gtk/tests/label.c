@@ -0,0 +1,108 @@
+/* GtkLabel tests.
+ * Copyright (C) 2009 Red Hat, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include <gtk/gtk.h>
+
+static void
+count_notify (GObject    *object,
+              GParamSpec *pspec,
+              gint       *count)
+{
+  (*count)++;
+}
+
+static void
+test_set_same_text (void)
+{
+  GtkWidget *label;
+  PangoLayout *layout;
+  gint notifies = 0;
+
+  label = gtk_label_new ("Some text");
+  g_object_ref_sink (label);
+  g_signal_connect (label, "notify::label",
+                    G_CALLBACK (count_notify), &notifies);
+
+  layout = gtk_label_get_layout (GTK_LABEL (label));
+
+  /* Setting the same plain text again is a no-op */
+  gtk_label_set_text (GTK_LABEL (label), "Some text");
+  g_assert (gtk_label_get_layout (GTK_LABEL (label)) == layout);
+  g_assert_cmpint (notifies, ==, 0);
+
+  gtk_label_set_text (GTK_LABEL (label), "Other text");
+  g_assert_cmpstr (gtk_label_get_text (GTK_LABEL (label)), ==, "Other text");
+  g_assert_cmpint (notifies, ==, 1);
+
+  g_object_unref (label);
+}
+
+static void
+test_set_same_text_clears_pattern (void)
+{
+  GtkWidget *label;
+  PangoLayout *layout;
+
+  g_object_set (gtk_settings_get_default (),
+                "gtk-enable-mnemonics", TRUE, NULL);
+
+  label = gtk_label_new ("Some text");
+  g_object_ref_sink (label);
+
+  gtk_label_set_pattern (GTK_LABEL (label), "_");
+  layout = gtk_label_get_layout (GTK_LABEL (label));
+  g_assert (pango_layout_get_attributes (layout) != NULL);
+
+  gtk_label_set_text (GTK_LABEL (label), "Some text");
+  layout = gtk_label_get_layout (GTK_LABEL (label));
+  g_assert (pango_layout_get_attributes (layout) == NULL);
+
+  g_object_unref (label);
+}
+
+static void
+test_set_same_text_underline (void)
+{
+  GtkWidget *label;
+
+  label = gtk_label_new_with_mnemonic ("_Some text");
+  g_object_ref_sink (label);
+  g_assert (gtk_label_get_use_underline (GTK_LABEL (label)));
+
+  gtk_label_set_text (GTK_LABEL (label), "_Some text");
+  g_assert (!gtk_label_get_use_underline (GTK_LABEL (label)));
+  g_assert_cmpstr (gtk_label_get_text (GTK_LABEL (label)), ==, "_Some text");
+
+  g_object_unref (label);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv);
+
+  g_test_add_func ("/label/set-same-text", test_set_same_text);
+  g_test_add_func ("/label/set-same-text-clears-pattern",
+                   test_set_same_text_clears_pattern);
+  g_test_add_func ("/label/set-same-text-underline",
+                   test_set_same_text_underline);
+
+  return g_test_run ();
+}
@@ -0,0 +1,279 @@
+/* Streamed selection transfer tests.
+ * Copyright (C) 2009 Red Hat, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include <string.h>
+#include <gtk/gtk.h>
+
+/* Larger than one stream chunk, and not a multiple of it */
+#define DATA_LENGTH 600001
+
+typedef struct
+{
+  gint offset;
+  gboolean destroyed;
+} Source;
+
+typedef struct
+{
+  GString *data;
+  gint n_chunks;
+  gint final_length;
+  gboolean finished;
+  gboolean destroyed;
+} Sink;
+
+static guchar
+pattern (gint offset)
+{
+  return 'a' + offset % 23;
+}
+
+static gint
+source_read (GtkSelectionData *selection_data,
+             guchar           *buffer,
+             gint              max_length,
+             gpointer          user_data)
+{
+  Source *source = user_data;
+  gint length, i;
+
+  length = MIN (max_length, DATA_LENGTH - source->offset);
+  for (i = 0; i < length; i++)
+    buffer[i] = pattern (source->offset + i);
+  source->offset += length;
+
+  return length;
+}
+
+static void
+source_destroy (gpointer user_data)
+{
+  Source *source = user_data;
+
+  source->destroyed = TRUE;
+}
+
+static void
+selection_get (GtkWidget        *widget,
+               GtkSelectionData *selection_data,
+               guint             info,
+               guint             time_,
+               Source           *source)
+{
+  gtk_selection_data_set_stream (selection_data,
+                                 gdk_atom_intern_static_string ("STRING"), 8,
+                                 DATA_LENGTH, source_read, source,
+                                 source_destroy);
+}
+
+static void
+sink_chunk (GtkSelectionData *chunk,
+            gpointer          user_data)
+{
+  Sink *sink = user_data;
+  gint length = gtk_selection_data_get_length (chunk);
+
+  g_assert (!sink->finished);
+
+  if (length > 0)
+    {
+      g_string_append_len (sink->data,
+                           (const gchar *) gtk_selection_data_get_data (chunk),
+                           length);
+      sink->n_chunks++;
+    }
+  else
+    {
+      sink->finished = TRUE;
+      sink->final_length = length;
+    }
+}
+
+static void
+sink_destroy (gpointer user_data)
+{
+  Sink *sink = user_data;
+
+  g_assert (sink->finished);
+  sink->destroyed = TRUE;
+}
+
+static void
+check_data (const guchar *data,
+            gint          length)
+{
+  gint i;
+
+  g_assert_cmpint (length, ==, DATA_LENGTH);
+  for (i = 0; i < length; i++)
+    if (data[i] != pattern (i))
+      g_error ("unexpected byte at offset %d", i);
+}
+
+static GtkWidget *
+make_owner (GdkAtom  selection,
+            Source  *source)
+{
+  GtkWidget *owner;
+
+  owner = gtk_invisible_new ();
+  gtk_selection_add_target (owner, selection,
+                            gdk_atom_intern_static_string ("STRING"), 0);
+  g_signal_connect (owner, "selection-get",
+                    G_CALLBACK (selection_get), source);
+  g_assert (gtk_selection_owner_set (owner, selection, GDK_CURRENT_TIME));
+
+  return owner;
+}
+
+static void
+test_stream_to_stream (void)
+{
+  GdkAtom selection = gdk_atom_intern_static_string ("GTK_TEST_STREAM_1");
+  Source source = { 0, FALSE };
+  Sink sink = { NULL, 0, 0, FALSE, FALSE };
+  GtkWidget *owner, *requestor;
+
+  owner = make_owner (selection, &source);
+  requestor = gtk_invisible_new ();
+  sink.data = g_string_new (NULL);
+
+  g_assert (gtk_selection_convert_streamed (requestor, selection,
+                                            gdk_atom_intern_static_string ("STRING"),
+                                            GDK_CURRENT_TIME,
+                                            sink_chunk, &sink, sink_destroy));
+
+  /* The owner is in this process, so the transfer is synchronous */
+  g_assert (sink.finished);
+  g_assert (sink.destroyed);
+  g_assert_cmpint (sink.final_length, ==, 0);
+  g_assert_cmpint (sink.n_chunks, >, 1);
+  check_data ((const guchar *) sink.data->str, sink.data->len);
+  g_assert (source.destroyed);
+
+  g_string_free (sink.data, TRUE);
+  gtk_widget_destroy (requestor);
+  gtk_widget_destroy (owner);
+}
+
+static void
+selection_received (GtkWidget        *widget,
+                    GtkSelectionData *selection_data,
+                    guint             time_,
+                    gboolean         *received)
+{
+  check_data (gtk_selection_data_get_data (selection_data),
+              gtk_selection_data_get_length (selection_data));
+  *received = TRUE;
+}
+
+static void
+test_stream_to_buffer (void)
+{
+  GdkAtom selection = gdk_atom_intern_static_string ("GTK_TEST_STREAM_2");
+  Source source = { 0, FALSE };
+  GtkWidget *owner, *requestor;
+  gboolean received = FALSE;
+
+  owner = make_owner (selection, &source);
+  requestor = gtk_invisible_new ();
+  g_signal_connect (requestor, "selection-received",
+                    G_CALLBACK (selection_received), &received);
+
+  g_assert (gtk_selection_convert (requestor, selection,
+                                   gdk_atom_intern_static_string ("STRING"),
+                                   GDK_CURRENT_TIME));
+
+  g_assert (received);
+  g_assert (source.destroyed);
+
+  gtk_widget_destroy (requestor);
+  gtk_widget_destroy (owner);
+}
+
+static void
+test_stream_not_taken (void)
+{
+  GdkAtom selection = gdk_atom_intern_static_string ("GTK_TEST_STREAM_3");
+  Source source = { 0, FALSE };
+  GtkSelectionData data;
+  GtkWidget *owner;
+
+  owner = make_owner (selection, &source);
+
+  data.selection = selection;
+  data.target = gdk_atom_intern_static_string ("STRING");
+  data.data = NULL;
+  data.length = -1;
+  data.display = gtk_widget_get_display (owner);
+
+  /* Emitted outside of a selection request, nobody takes the stream,
+   * so it is read to the end right away.
+   */
+  g_signal_emit_by_name (owner, "selection-get", &data, 0, GDK_CURRENT_TIME);
+
+  g_assert (source.destroyed);
+  check_data (data.data, data.length);
+
+  g_free (data.data);
+  gtk_widget_destroy (owner);
+}
+
+static void
+test_abort_on_destroy (void)
+{
+  GdkAtom selection = gdk_atom_intern_static_string ("GTK_TEST_STREAM_UNOWNED");
+  Sink sink = { NULL, 0, 0, FALSE, FALSE };
+  GtkWidget *requestor;
+
+  requestor = gtk_invisible_new ();
+  sink.data = g_string_new (NULL);
+
+  /* Nobody in this process owns the selection, so the request goes
+   * through the server and is still pending when the requestor dies.
+   */
+  g_assert (gtk_selection_convert_streamed (requestor, selection,
+                                            gdk_atom_intern_static_string ("STRING"),
+                                            GDK_CURRENT_TIME,
+                                            sink_chunk, &sink, sink_destroy));
+  g_assert (!sink.finished);
+
+  gtk_widget_destroy (requestor);
+
+  g_assert (sink.finished);
+  g_assert (sink.destroyed);
+  g_assert_cmpint (sink.final_length, ==, -1);
+  g_assert_cmpint (sink.data->len, ==, 0);
+
+  g_string_free (sink.data, TRUE);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv);
+
+  g_test_add_func ("/selection/stream-to-stream", test_stream_to_stream);
+  g_test_add_func ("/selection/stream-to-buffer", test_stream_to_buffer);
+  g_test_add_func ("/selection/stream-not-taken", test_stream_not_taken);
+  g_test_add_func ("/selection/abort-on-destroy", test_abort_on_destroy);
+
+  return g_test_run ();
+}
@@ -1284,6 +1284,600 @@ test_tag (void)
   g_object_unref (buffer);
 }
 
+static void
+check_search (GtkTextBuffer      *buffer,
+              const gchar        *str,
+              GtkTextSearchFlags  flags,
+              gint                expected_start,
+              gint                expected_end)
+{
+  GtkTextIter iter, match_start, match_end;
+  gboolean found;
+
+  gtk_text_buffer_get_start_iter (buffer, &iter);
+  found = gtk_text_iter_forward_search (&iter, str, flags,
+                                        &match_start, &match_end, NULL);
+  if (expected_start < 0)
+    {
+      g_assert (!found);
+      return;
+    }
+
+  g_assert (found);
+  g_assert_cmpint (gtk_text_iter_get_offset (&match_start), ==, expected_start);
+  g_assert_cmpint (gtk_text_iter_get_offset (&match_end), ==, expected_end);
+
+  gtk_text_buffer_get_end_iter (buffer, &iter);
+  found = gtk_text_iter_backward_search (&iter, str, flags,
+                                         &match_start, &match_end, NULL);
+  g_assert (found);
+}
+
+static void
+test_search (void)
+{
+  GtkTextBuffer *buffer;
+  GtkTextIter iter;
+  gint *offsets;
+  gint n_matches;
+
+  buffer = gtk_text_buffer_new (NULL);
+
+  gtk_text_buffer_set_text (buffer, "Foo bar\nfoobar Bar\nbar", -1);
+
+  check_search (buffer, "bar", 0, 4, 7);
+  check_search (buffer, "Bar", 0, 15, 18);
+  check_search (buffer, "BAR", 0, -1, -1);
+  check_search (buffer, "BAR", GTK_TEXT_SEARCH_CASE_INSENSITIVE, 4, 7);
+  check_search (buffer, "foo", 0, 8, 11);
+  check_search (buffer, "foo", GTK_TEXT_SEARCH_CASE_INSENSITIVE, 0, 3);
+  check_search (buffer, "foo", GTK_TEXT_SEARCH_WHOLE_WORD, -1, -1);
+  check_search (buffer, "bar\nfoo", 0, 4, 11);
+  check_search (buffer, "Bar\nbar", 0, 15, 22);
+
+  gtk_text_buffer_get_start_iter (buffer, &iter);
+
+  offsets = gtk_text_iter_forward_search_all (&iter, "bar", 0, NULL, &n_matches);
+  g_assert_cmpint (n_matches, ==, 3);
+  g_assert_cmpint (offsets[0], ==, 4);
+  g_assert_cmpint (offsets[2], ==, 11);
+  g_assert_cmpint (offsets[4], ==, 19);
+  g_assert_cmpint (offsets[5], ==, 22);
+  g_free (offsets);
+
+  offsets = gtk_text_iter_forward_search_all (&iter, "bar",
+                                              GTK_TEXT_SEARCH_CASE_INSENSITIVE |
+                                              GTK_TEXT_SEARCH_WHOLE_WORD,
+                                              NULL, &n_matches);
+  g_assert_cmpint (n_matches, ==, 3);
+  g_assert_cmpint (offsets[0], ==, 4);
+  g_assert_cmpint (offsets[2], ==, 15);
+  g_assert_cmpint (offsets[4], ==, 19);
+  g_free (offsets);
+
+  offsets = gtk_text_iter_forward_search_all (&iter, "baz", 0, NULL, &n_matches);
+  g_assert_cmpint (n_matches, ==, 0);
+  g_assert (offsets == NULL);
+
+  g_object_unref (buffer);
+}
+
+static void
+test_long_line (void)
+{
+  GtkTextBuffer *buffer;
+  GtkTextIter start, end;
+  GString *str;
+  gchar *text;
+  gint i;
+
+  /* Long lines are split over several segments; make sure that
+   * doesn't cut characters or line delimiters in half.
+   */
+  str = g_string_new (NULL);
+  for (i = 0; i < 5000; i++)
+    g_string_append (str, "\303\251x");
+  g_string_append (str, "\r\n");
+  for (i = 0; i < 5000; i++)
+    g_string_append (str, "y");
+
+  buffer = gtk_text_buffer_new (NULL);
+  gtk_text_buffer_set_text (buffer, str->str, -1);
+
+  g_assert_cmpint (gtk_text_buffer_get_line_count (buffer), ==, 2);
+  g_assert_cmpint (gtk_text_buffer_get_char_count (buffer), ==, 15002);
+
+  gtk_text_buffer_get_iter_at_offset (buffer, &start, 4097);
+  g_assert_cmpint (gtk_text_iter_get_char (&start), ==, 'x');
+  g_assert_cmpint (gtk_text_iter_get_line_index (&start), ==, 6146);
+
+  gtk_text_buffer_insert (buffer, &start, "z", 1);
+  g_string_insert (str, 6146, "z");
+
+  gtk_text_buffer_get_iter_at_line (buffer, &start, 1);
+  g_assert_cmpint (gtk_text_iter_get_offset (&start), ==, 10003);
+
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  text = gtk_text_buffer_get_text (buffer, &start, &end, TRUE);
+  g_assert_cmpstr (text, ==, str->str);
+  g_free (text);
+
+  g_string_free (str, TRUE);
+  g_object_unref (buffer);
+}
+
+static guint8 *
+serialize_to_stream (GtkTextBuffer *buffer,
+                     GdkAtom        format,
+                     gsize         *length)
+{
+  GOutputStream *stream;
+  GtkTextIter start, end;
+  GError *error = NULL;
+  guint8 *data;
+
+  stream = g_memory_output_stream_new (NULL, 0, g_realloc, NULL);
+
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  g_assert (gtk_text_buffer_serialize_to_stream (buffer, buffer, format,
+                                                 &start, &end, stream,
+                                                 NULL, &error));
+  g_assert_no_error (error);
+  g_assert (g_output_stream_close (stream, NULL, NULL));
+
+  data = g_memory_output_stream_get_data (G_MEMORY_OUTPUT_STREAM (stream));
+  *length = g_memory_output_stream_get_data_size (G_MEMORY_OUTPUT_STREAM (stream));
+
+  g_object_unref (stream);
+
+  return data;
+}
+
+static GtkTextBuffer *
+deserialize_from_stream (const guint8 *data,
+                         gsize         length)
+{
+  GtkTextBuffer *buffer;
+  GInputStream *stream;
+  GtkTextIter iter;
+  GdkAtom format;
+  GError *error = NULL;
+
+  buffer = gtk_text_buffer_new (NULL);
+  format = gtk_text_buffer_register_deserialize_tagset (buffer, NULL);
+  gtk_text_buffer_deserialize_set_can_create_tags (buffer, format, TRUE);
+
+  stream = g_memory_input_stream_new_from_data (data, length, NULL);
+
+  gtk_text_buffer_get_start_iter (buffer, &iter);
+  g_assert (gtk_text_buffer_deserialize_from_stream (buffer, buffer, format,
+                                                     &iter, stream,
+                                                     NULL, &error));
+  g_assert_no_error (error);
+  g_assert (gtk_text_iter_is_end (&iter));
+
+  g_object_unref (stream);
+
+  return buffer;
+}
+
+static void
+test_serialize_stream (void)
+{
+  GtkTextBuffer *buffer, *buffer2, *buffer3;
+  GtkTextIter start, end, iter;
+  GdkAtom format;
+  guint8 *data, *data2;
+  gsize length, length2;
+  GError *error = NULL;
+
+  buffer = gtk_text_buffer_new (NULL);
+  fill_buffer (buffer);
+  format = gtk_text_buffer_register_serialize_tagset (buffer, NULL);
+
+  /* Streaming writes the same data as serializing in memory */
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  data = gtk_text_buffer_serialize (buffer, buffer, format, &start, &end, &length);
+  data2 = serialize_to_stream (buffer, format, &length2);
+
+  g_assert_cmpuint (length, ==, length2);
+  g_assert (memcmp (data, data2, length) == 0);
+  g_free (data2);
+
+  /* Streaming reads back the same contents as deserializing in memory */
+  buffer2 = deserialize_from_stream (data, length);
+
+  buffer3 = gtk_text_buffer_new (NULL);
+  format = gtk_text_buffer_register_deserialize_tagset (buffer3, NULL);
+  gtk_text_buffer_deserialize_set_can_create_tags (buffer3, format, TRUE);
+  gtk_text_buffer_get_start_iter (buffer3, &iter);
+  g_assert (gtk_text_buffer_deserialize (buffer3, buffer3, format, &iter,
+                                         data, length, &error));
+  g_assert_no_error (error);
+  g_free (data);
+
+  format = gtk_text_buffer_register_serialize_tagset (buffer2, NULL);
+  gtk_text_buffer_get_bounds (buffer2, &start, &end);
+  data = gtk_text_buffer_serialize (buffer2, buffer2, format, &start, &end, &length);
+
+  format = gtk_text_buffer_register_serialize_tagset (buffer3, NULL);
+  gtk_text_buffer_get_bounds (buffer3, &start, &end);
+  data2 = gtk_text_buffer_serialize (buffer3, buffer3, format, &start, &end, &length2);
+
+  g_assert_cmpuint (length, ==, length2);
+  g_assert (memcmp (data, data2, length) == 0);
+  g_free (data);
+  g_free (data2);
+
+  g_object_unref (buffer);
+  g_object_unref (buffer2);
+  g_object_unref (buffer3);
+}
+
+static void
+test_serialize_stream_tagged_pixbuf (void)
+{
+  GtkTextBuffer *buffer, *buffer2;
+  GtkTextIter start, end, iter;
+  GdkPixbuf *pixbuf;
+  GSList *tags;
+  GdkAtom format;
+  guint8 *data;
+  gsize length;
+  gint weight;
+
+  buffer = gtk_text_buffer_new (NULL);
+  gtk_text_buffer_create_tag (buffer, "bold",
+                              "weight", PANGO_WEIGHT_BOLD, NULL);
+
+  pixbuf = gdk_pixbuf_new (GDK_COLORSPACE_RGB, FALSE, 8, 4, 4);
+  gdk_pixbuf_fill (pixbuf, 0xff0000ff);
+
+  gtk_text_buffer_set_text (buffer, "ab", -1);
+  gtk_text_buffer_get_iter_at_offset (buffer, &iter, 1);
+  gtk_text_buffer_insert_pixbuf (buffer, &iter, pixbuf);
+  g_object_unref (pixbuf);
+
+  /* Tag the pixbuf and the character after it */
+  gtk_text_buffer_get_iter_at_offset (buffer, &start, 1);
+  gtk_text_buffer_get_end_iter (buffer, &end);
+  gtk_text_buffer_apply_tag_by_name (buffer, "bold", &start, &end);
+
+  format = gtk_text_buffer_register_serialize_tagset (buffer, NULL);
+  data = serialize_to_stream (buffer, format, &length);
+  buffer2 = deserialize_from_stream (data, length);
+  g_free (data);
+
+  g_assert_cmpint (gtk_text_buffer_get_char_count (buffer2), ==, 3);
+
+  gtk_text_buffer_get_start_iter (buffer2, &iter);
+  tags = gtk_text_iter_get_tags (&iter);
+  g_assert (tags == NULL);
+
+  gtk_text_iter_forward_char (&iter);
+  g_assert (gtk_text_iter_get_pixbuf (&iter) != NULL);
+  tags = gtk_text_iter_get_tags (&iter);
+  g_assert_cmpint (g_slist_length (tags), ==, 1);
+  g_object_get (tags->data, "weight", &weight, NULL);
+  g_assert_cmpint (weight, ==, PANGO_WEIGHT_BOLD);
+  g_slist_free (tags);
+
+  gtk_text_iter_forward_char (&iter);
+  g_assert_cmpint (gtk_text_iter_get_char (&iter), ==, 'b');
+  tags = gtk_text_iter_get_tags (&iter);
+  g_assert_cmpint (g_slist_length (tags), ==, 1);
+  g_slist_free (tags);
+
+  g_object_unref (buffer);
+  g_object_unref (buffer2);
+}
+
+static void
+test_serialize_stream_perf (void)
+{
+  GtkTextBuffer *buffer, *buffer2;
+  GtkTextTag *bold, *anonymous;
+  GtkTextIter start, end;
+  GdkAtom format;
+  GFile *file;
+  GOutputStream *ostream;
+  GInputStream *istream;
+  gchar *filename;
+  gint i, n_lines;
+  gdouble elapsed;
+  GError *error = NULL;
+
+  /* About 100 MB of text with tags on every line */
+  n_lines = 1200000;
+
+  buffer = gtk_text_buffer_new (NULL);
+  bold = gtk_text_buffer_create_tag (buffer, "bold", "weight", PANGO_WEIGHT_BOLD, NULL);
+  anonymous = gtk_text_buffer_create_tag (buffer, NULL, "style", PANGO_STYLE_ITALIC, NULL);
+
+  gtk_text_buffer_get_end_iter (buffer, &end);
+  for (i = 0; i < n_lines; i++)
+    {
+      gtk_text_buffer_insert_with_tags (buffer, &end, "Whan that Aprill with his shoures soote ",
+                                        -1, bold, NULL);
+      gtk_text_buffer_insert_with_tags (buffer, &end, "the droghte of March hath perced to the roote\n",
+                                        -1, i % 2 ? anonymous : bold, NULL);
+    }
+
+  filename = g_build_filename (g_get_tmp_dir (), "textbuffer-serialize", NULL);
+  file = g_file_new_for_path (filename);
+
+  format = gtk_text_buffer_register_serialize_tagset (buffer, NULL);
+
+  g_test_timer_start ();
+
+  ostream = G_OUTPUT_STREAM (g_file_replace (file, NULL, FALSE, 0, NULL, &error));
+  g_assert_no_error (error);
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  g_assert (gtk_text_buffer_serialize_to_stream (buffer, buffer, format,
+                                                 &start, &end, ostream,
+                                                 NULL, &error));
+  g_assert_no_error (error);
+  g_output_stream_close (ostream, NULL, NULL);
+  g_object_unref (ostream);
+
+  buffer2 = gtk_text_buffer_new (NULL);
+  format = gtk_text_buffer_register_deserialize_tagset (buffer2, NULL);
+  gtk_text_buffer_deserialize_set_can_create_tags (buffer2, format, TRUE);
+
+  istream = G_INPUT_STREAM (g_file_read (file, NULL, &error));
+  g_assert_no_error (error);
+  gtk_text_buffer_get_start_iter (buffer2, &start);
+  g_assert (gtk_text_buffer_deserialize_from_stream (buffer2, buffer2, format,
+                                                     &start, istream,
+                                                     NULL, &error));
+  g_assert_no_error (error);
+  g_object_unref (istream);
+
+  elapsed = g_test_timer_elapsed ();
+
+  g_assert_cmpint (gtk_text_buffer_get_char_count (buffer2), ==,
+                   gtk_text_buffer_get_char_count (buffer));
+
+  g_test_maximized_result (gtk_text_buffer_get_char_count (buffer) / elapsed / (1024 * 1024),
+                           "Rich text round trip: %.1f MB/s",
+                           gtk_text_buffer_get_char_count (buffer) / elapsed / (1024 * 1024));
+
+  g_file_delete (file, NULL, NULL);
+  g_object_unref (file);
+  g_free (filename);
+  g_object_unref (buffer);
+  g_object_unref (buffer2);
+}
+
+static void
+count_apply_tag (GtkTextBuffer *buffer,
+                 GtkTextTag    *tag,
+                 GtkTextIter   *start,
+                 GtkTextIter   *end,
+                 gint          *count)
+{
+  (*count)++;
+}
+
+static void
+check_tagged (GtkTextBuffer *buffer,
+              GtkTextTag    *tag,
+              const gchar   *expected)
+{
+  GtkTextIter iter;
+  gint i;
+
+  for (i = 0; expected[i]; i++)
+    {
+      gtk_text_buffer_get_iter_at_offset (buffer, &iter, i);
+      g_assert_cmpint (gtk_text_iter_has_tag (&iter, tag), ==, expected[i] == 'x');
+    }
+}
+
+static void
+test_apply_tag_spans (void)
+{
+  GtkTextBuffer *buffer;
+  GtkTextTag *bold, *red;
+  GtkTextTagSpan spans[6];
+  gint count = 0;
+
+  buffer = gtk_text_buffer_new (NULL);
+  gtk_text_buffer_set_text (buffer, "0123456789abcdefghij", -1);
+  bold = gtk_text_buffer_create_tag (buffer, NULL,
+                                     "weight", PANGO_WEIGHT_BOLD, NULL);
+  red = gtk_text_buffer_create_tag (buffer, NULL, "foreground", "red", NULL);
+  g_signal_connect (buffer, "apply-tag", G_CALLBACK (count_apply_tag), &count);
+
+  /* Unsorted, reversed, overlapping and touching spans */
+  spans[0].tag = bold; spans[0].start_offset = 8; spans[0].end_offset = 5;
+  spans[1].tag = red; spans[1].start_offset = 18; spans[1].end_offset = 20;
+  spans[2].tag = bold; spans[2].start_offset = 0; spans[2].end_offset = 2;
+  spans[3].tag = bold; spans[3].start_offset = 7; spans[3].end_offset = 10;
+  spans[4].tag = bold; spans[4].start_offset = 10; spans[4].end_offset = 12;
+  spans[5].tag = red; spans[5].start_offset = 3; spans[5].end_offset = 3;
+
+  gtk_text_buffer_apply_tag_spans (buffer, spans, G_N_ELEMENTS (spans));
+
+  /* bold 0-2 and 5-12, red 18-20; the empty span is skipped */
+  g_assert_cmpint (count, ==, 3);
+  check_tagged (buffer, bold, "xx---xxxxxxx--------");
+  check_tagged (buffer, red,  "------------------xx");
+
+  g_object_unref (buffer);
+}
+
+/* Inserts text at the start of the buffer the first time a tag is
+ * applied, moving everything that was tagged before.
+ */
+static void
+insert_on_apply_tag (GtkTextBuffer *buffer,
+                     GtkTextTag    *tag,
+                     GtkTextIter   *start,
+                     GtkTextIter   *end,
+                     gboolean      *inserted)
+{
+  GtkTextIter iter;
+
+  if (*inserted)
+    return;
+
+  *inserted = TRUE;
+  gtk_text_buffer_get_start_iter (buffer, &iter);
+  gtk_text_buffer_insert (buffer, &iter, "ABC", -1);
+
+  gtk_text_buffer_get_iter_at_offset (buffer, start, 3 + 5);
+  gtk_text_buffer_get_iter_at_offset (buffer, end, 3 + 8);
+}
+
+static void
+test_apply_tag_spans_edit (void)
+{
+  GtkTextBuffer *buffer;
+  GtkTextView *view;
+  GtkTextTag *big;
+  GtkTextTagSpan spans[2];
+  gboolean inserted = FALSE;
+  GtkTextIter start, end;
+  gchar *text;
+
+  buffer = gtk_text_buffer_new (NULL);
+  view = GTK_TEXT_VIEW (gtk_text_view_new_with_buffer (buffer));
+  g_object_ref_sink (view);
+  gtk_text_buffer_set_text (buffer, "0123456789\n0123456789", -1);
+  big = gtk_text_buffer_create_tag (buffer, NULL, "scale", 2.0, NULL);
+  g_signal_connect (buffer, "apply-tag",
+                    G_CALLBACK (insert_on_apply_tag), &inserted);
+
+  spans[0].tag = big; spans[0].start_offset = 5; spans[0].end_offset = 8;
+  spans[1].tag = big; spans[1].start_offset = 15; spans[1].end_offset = 20;
+
+  /* The pending relayout of the first span must follow the inserted
+   * text instead of pointing at stale offsets.
+   */
+  gtk_text_buffer_apply_tag_spans (buffer, spans, G_N_ELEMENTS (spans));
+
+  g_assert (inserted);
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  text = gtk_text_buffer_get_text (buffer, &start, &end, TRUE);
+  g_assert_cmpstr (text, ==, "ABC0123456789\n0123456789");
+  g_free (text);
+
+  gtk_text_buffer_get_iter_at_offset (buffer, &start, 3 + 5);
+  g_assert (gtk_text_iter_begins_tag (&start, big));
+
+  g_object_unref (view);
+  g_object_unref (buffer);
+}
+
+typedef struct
+{
+  GMainLoop *loop;
+  gboolean success;
+  GError *error;
+} InsertStreamResult;
+
+static void
+insert_stream_done (GObject      *source,
+                    GAsyncResult *result,
+                    gpointer      user_data)
+{
+  InsertStreamResult *res = user_data;
+
+  res->success = gtk_text_buffer_insert_stream_finish (GTK_TEXT_BUFFER (source),
+                                                       result, &res->error);
+  g_main_loop_quit (res->loop);
+}
+
+static void
+insert_stream (GtkTextBuffer      *buffer,
+               gint                offset,
+               const gchar        *data,
+               gsize               length,
+               gboolean            delete_around,
+               InsertStreamResult *res)
+{
+  GInputStream *stream;
+  GtkTextIter iter, start, end;
+
+  stream = g_memory_input_stream_new_from_data (data, length, NULL);
+  res->loop = g_main_loop_new (NULL, FALSE);
+  res->success = FALSE;
+  res->error = NULL;
+
+  gtk_text_buffer_get_iter_at_offset (buffer, &iter, offset);
+  gtk_text_buffer_insert_stream_async (buffer, &iter, stream,
+                                       G_PRIORITY_DEFAULT, NULL, NULL, NULL,
+                                       insert_stream_done, res);
+
+  /* Nothing has been read yet; remove the text on both sides of the
+   * insertion point.
+   */
+  if (delete_around)
+    {
+      gtk_text_buffer_get_iter_at_offset (buffer, &start, offset - 1);
+      gtk_text_buffer_get_iter_at_offset (buffer, &end, offset + 1);
+      gtk_text_buffer_delete (buffer, &start, &end);
+    }
+
+  g_main_loop_run (res->loop);
+  g_main_loop_unref (res->loop);
+  g_object_unref (stream);
+}
+
+static void
+test_insert_stream (void)
+{
+  GtkTextBuffer *buffer;
+  GtkTextIter start, end;
+  InsertStreamResult res;
+  GString *str;
+  gchar *expected, *text;
+
+  /* Several chunks, so that multi-byte characters end up split
+   * between two of them.
+   */
+  str = g_string_new (NULL);
+  while (str->len < 3 * 262144)
+    g_string_append (str, "h\303\251llo \342\202\254 w\303\266rld\r\n");
+
+  buffer = gtk_text_buffer_new (NULL);
+  gtk_text_buffer_set_text (buffer, "abcdef", -1);
+
+  insert_stream (buffer, 3, str->str, str->len, FALSE, &res);
+  g_assert_no_error (res.error);
+  g_assert (res.success);
+
+  expected = g_strconcat ("abc", str->str, "def", NULL);
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  text = gtk_text_buffer_get_text (buffer, &start, &end, TRUE);
+  g_assert (strcmp (text, expected) == 0);
+  g_free (text);
+  g_free (expected);
+
+  /* Invalid UTF-8 stops loading */
+  gtk_text_buffer_set_text (buffer, "", -1);
+  insert_stream (buffer, 0, "abc\377def", 7, FALSE, &res);
+  g_assert_error (res.error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA);
+  g_assert (!res.success);
+  g_clear_error (&res.error);
+
+  /* So does losing the insertion point */
+  gtk_text_buffer_set_text (buffer, "abcdef", -1);
+  insert_stream (buffer, 3, str->str, str->len, TRUE, &res);
+  g_assert_error (res.error, G_IO_ERROR, G_IO_ERROR_FAILED);
+  g_assert (!res.success);
+  g_clear_error (&res.error);
+
+  gtk_text_buffer_get_bounds (buffer, &start, &end);
+  text = gtk_text_buffer_get_text (buffer, &start, &end, TRUE);
+  g_assert_cmpstr (text, ==, "abef");
+  g_free (text);
+
+  g_string_free (str, TRUE);
+  g_object_unref (buffer);
+}
+
 extern void pixbuf_init (void);
 
 int
@@ -1303,6 +1897,16 @@ main (int argc, char** argv)
   g_test_add_func ("/TextBuffer/Get and Set", test_get_set);
   g_test_add_func ("/TextBuffer/Fill and Empty", test_fill_empty);
   g_test_add_func ("/TextBuffer/Tag", test_tag);
+  g_test_add_func ("/TextBuffer/Search", test_search);
+  g_test_add_func ("/TextBuffer/Long line", test_long_line);
+  g_test_add_func ("/TextBuffer/Serialize stream", test_serialize_stream);
+  g_test_add_func ("/TextBuffer/Serialize stream tagged pixbuf",
+                   test_serialize_stream_tagged_pixbuf);
+  g_test_add_func ("/TextBuffer/Apply tag spans", test_apply_tag_spans);
+  g_test_add_func ("/TextBuffer/Apply tag spans with edits", test_apply_tag_spans_edit);
+  g_test_add_func ("/TextBuffer/Insert stream", test_insert_stream);
+  if (g_test_perf ())
+    g_test_add_func ("/TextBuffer/Serialize stream performance", test_serialize_stream_perf);
   
   return g_test_run();
 }
@@ -0,0 +1,415 @@
+/* GtkTreeView tests.
+ * Copyright (C) 2009 Red Hat, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the
+ * Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+#include <string.h>
+#include <gtk/gtk.h>
+
+typedef struct
+{
+  GtkWidget *window;
+  GtkTreeView *tree_view;
+  GtkTreeStore *store;
+
+  /* Rows whose cell data was set, while drawing and at any time */
+  GString *drawn;
+  GString *all;
+  gboolean drawing;
+} CacheFixture;
+
+static void
+log_cell_data (GtkTreeViewColumn *column,
+               GtkCellRenderer   *cell,
+               GtkTreeModel      *model,
+               GtkTreeIter       *iter,
+               gpointer           data)
+{
+  CacheFixture *fixture = data;
+  gchar *text;
+
+  gtk_tree_model_get (model, iter, 0, &text, -1);
+  g_object_set (cell, "text", text, NULL);
+
+  g_string_append_printf (fixture->all, "[%s]", text);
+  if (fixture->drawing)
+    g_string_append_printf (fixture->drawn, "[%s]", text);
+
+  g_free (text);
+}
+
+static void
+flush_events (void)
+{
+  gdk_display_sync (gdk_display_get_default ());
+
+  while (gtk_events_pending ())
+    gtk_main_iteration ();
+}
+
+/* Exposes all of the rows and records which ones were rendered */
+static void
+redraw (CacheFixture *fixture)
+{
+  GdkWindow *bin_window = gtk_tree_view_get_bin_window (fixture->tree_view);
+
+  g_string_truncate (fixture->drawn, 0);
+
+  fixture->drawing = TRUE;
+  gdk_window_invalidate_rect (bin_window, NULL, FALSE);
+  gdk_window_process_updates (bin_window, FALSE);
+  fixture->drawing = FALSE;
+}
+
+/* Checks that the rows come from the cache and look the same as the
+ * rows rendered without it, which are @expected.
+ */
+static void
+check_cached_rows (CacheFixture *fixture,
+                   const gchar  *expected)
+{
+  GdkWindow *bin_window = gtk_tree_view_get_bin_window (fixture->tree_view);
+  GdkImage *cached, *uncached;
+  gint width, height, y;
+
+  gdk_drawable_get_size (bin_window, &width, &height);
+
+  redraw (fixture);
+  redraw (fixture);
+  g_assert_cmpstr (fixture->drawn->str, ==, "");
+  cached = gdk_drawable_get_image (bin_window, 0, 0, width, height);
+
+  gtk_tree_view_set_cache_rows (fixture->tree_view, FALSE);
+  flush_events ();
+  redraw (fixture);
+  g_assert_cmpstr (fixture->drawn->str, ==, expected);
+  uncached = gdk_drawable_get_image (bin_window, 0, 0, width, height);
+
+  gtk_tree_view_set_cache_rows (fixture->tree_view, TRUE);
+  flush_events ();
+
+  for (y = 0; y < height; y++)
+    g_assert (memcmp ((guchar *) cached->mem + y * cached->bpl,
+                      (guchar *) uncached->mem + y * uncached->bpl,
+                      width * cached->bpp) == 0);
+
+  g_object_unref (cached);
+  g_object_unref (uncached);
+}
+
+static void
+cache_fixture_setup (CacheFixture  *fixture,
+                     gconstpointer  test_data)
+{
+  GtkTreeViewColumn *column;
+  GtkCellRenderer *cell;
+  GtkTreeIter iter, child;
+
+  fixture->store = gtk_tree_store_new (1, G_TYPE_STRING);
+  gtk_tree_store_insert_with_values (fixture->store, &iter, NULL, -1, 0, "a", -1);
+  gtk_tree_store_insert_with_values (fixture->store, &iter, NULL, -1, 0, "b", -1);
+  gtk_tree_store_insert_with_values (fixture->store, &child, &iter, -1, 0, "b1", -1);
+  gtk_tree_store_insert_with_values (fixture->store, &child, &iter, -1, 0, "b2", -1);
+  gtk_tree_store_insert_with_values (fixture->store, &iter, NULL, -1, 0, "c", -1);
+
+  fixture->drawn = g_string_new (NULL);
+  fixture->all = g_string_new (NULL);
+
+  fixture->tree_view =
+    GTK_TREE_VIEW (gtk_tree_view_new_with_model (GTK_TREE_MODEL (fixture->store)));
+  gtk_tree_view_set_cache_rows (fixture->tree_view, TRUE);
+
+  /* A fixed width keeps changed text from resizing the column */
+  column = gtk_tree_view_column_new ();
+  gtk_tree_view_column_set_sizing (column, GTK_TREE_VIEW_COLUMN_FIXED);
+  gtk_tree_view_column_set_fixed_width (column, 100);
+  cell = gtk_cell_renderer_text_new ();
+  gtk_tree_view_column_pack_start (column, cell, TRUE);
+  gtk_tree_view_column_set_cell_data_func (column, cell,
+                                           log_cell_data, fixture, NULL);
+  gtk_tree_view_append_column (fixture->tree_view, column);
+
+  gtk_tree_view_expand_all (fixture->tree_view);
+
+  fixture->window = gtk_window_new (GTK_WINDOW_TOPLEVEL);
+  gtk_window_set_default_size (GTK_WINDOW (fixture->window), 200, 200);
+  gtk_container_add (GTK_CONTAINER (fixture->window),
+                     GTK_WIDGET (fixture->tree_view));
+  gtk_widget_show_all (fixture->window);
+  gtk_widget_show_now (fixture->window);
+
+  flush_events ();
+}
+
+static void
+cache_fixture_teardown (CacheFixture  *fixture,
+                        gconstpointer  test_data)
+{
+  gtk_widget_destroy (fixture->window);
+  g_object_unref (fixture->store);
+  g_string_free (fixture->drawn, TRUE);
+  g_string_free (fixture->all, TRUE);
+}
+
+static void
+test_cache_rows_redraw (CacheFixture  *fixture,
+                        gconstpointer  test_data)
+{
+  g_assert (gtk_tree_view_get_cache_rows (fixture->tree_view));
+
+  check_cached_rows (fixture, "[a][b][b1][b2][c]");
+}
+
+static void
+test_cache_rows_change (CacheFixture  *fixture,
+                        gconstpointer  test_data)
+{
+  GtkTreeIter iter;
+
+  check_cached_rows (fixture, "[a][b][b1][b2][c]");
+
+  g_assert (gtk_tree_model_get_iter_from_string (GTK_TREE_MODEL (fixture->store),
+                                                 &iter, "1:1"));
+  g_string_truncate (fixture->all, 0);
+  gtk_tree_store_set (fixture->store, &iter, 0, "bx", -1);
+  flush_events ();
+
+  /* Only the changed row is measured and rendered again */
+  g_assert (strstr (fixture->all->str, "[bx]") != NULL);
+  g_assert (strstr (fixture->all->str, "[a]") == NULL);
+  g_assert (strstr (fixture->all->str, "[b1]") == NULL);
+  g_assert (strstr (fixture->all->str, "[c]") == NULL);
+
+  check_cached_rows (fixture, "[a][b][b1][bx][c]");
+}
+
+static void
+test_cache_rows_reorder (CacheFixture  *fixture,
+                         gconstpointer  test_data)
+{
+  GtkTreeIter a, c;
+
+  check_cached_rows (fixture, "[a][b][b1][b2][c]");
+
+  g_assert (gtk_tree_model_get_iter_from_string (GTK_TREE_MODEL (fixture->store),
+                                                 &a, "0"));
+  g_assert (gtk_tree_model_get_iter_from_string (GTK_TREE_MODEL (fixture->store),
+                                                 &c, "2"));
+  gtk_tree_store_swap (fixture->store, &a, &c);
+  flush_events ();
+
+  check_cached_rows (fixture, "[c][b][b1][b2][a]");
+}
+
+static void
+test_cache_rows_collapse (CacheFixture  *fixture,
+                          gconstpointer  test_data)
+{
+  GtkTreePath *path;
+
+  check_cached_rows (fixture, "[a][b][b1][b2][c]");
+
+  path = gtk_tree_path_new_from_string ("1");
+  gtk_tree_view_collapse_row (fixture->tree_view, path);
+  gtk_tree_path_free (path);
+  flush_events ();
+
+  check_cached_rows (fixture, "[a][b][c]");
+}
+
+/* A text renderer that handles "text" in its own set_property() */
+typedef GtkCellRendererText TestTextRenderer;
+typedef GtkCellRendererTextClass TestTextRendererClass;
+
+enum
+{
+  PROP_0,
+  PROP_TEXT
+};
+
+static gchar *test_text_renderer_text = NULL;
+
+G_DEFINE_TYPE (TestTextRenderer, test_text_renderer, GTK_TYPE_CELL_RENDERER_TEXT)
+
+static void
+test_text_renderer_set_property (GObject      *object,
+                                 guint         prop_id,
+                                 const GValue *value,
+                                 GParamSpec   *pspec)
+{
+  switch (prop_id)
+    {
+    case PROP_TEXT:
+      g_free (test_text_renderer_text);
+      test_text_renderer_text = g_value_dup_string (value);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+    }
+}
+
+static void
+test_text_renderer_get_property (GObject    *object,
+                                 guint       prop_id,
+                                 GValue     *value,
+                                 GParamSpec *pspec)
+{
+  switch (prop_id)
+    {
+    case PROP_TEXT:
+      g_value_set_string (value, test_text_renderer_text);
+      break;
+
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+    }
+}
+
+static void
+test_text_renderer_class_init (TestTextRendererClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+
+  object_class->set_property = test_text_renderer_set_property;
+  object_class->get_property = test_text_renderer_get_property;
+
+  g_object_class_override_property (object_class, PROP_TEXT, "text");
+}
+
+static void
+test_text_renderer_init (TestTextRenderer *renderer)
+{
+}
+
+static GtkTreeViewColumn *
+create_text_column (GtkCellRenderer *cell,
+                    GtkTreeModel    *model,
+                    GtkTreeIter     *iter)
+{
+  GtkListStore *store = GTK_LIST_STORE (model);
+  GtkTreeViewColumn *column;
+
+  gtk_list_store_insert_with_values (store, &iter[0], -1, 0, "first", -1);
+  gtk_list_store_insert_with_values (store, &iter[1], -1, 0, "second", -1);
+
+  column = gtk_tree_view_column_new_with_attributes (NULL, cell,
+                                                     "text", 0,
+                                                     NULL);
+  g_object_ref_sink (column);
+
+  return column;
+}
+
+static void
+count_notify (GObject    *object,
+              GParamSpec *pspec,
+              gint       *count)
+{
+  (*count)++;
+}
+
+static void
+test_column_set_cell_data_notify (void)
+{
+  GtkTreeModel *model;
+  GtkTreeViewColumn *column;
+  GtkCellRenderer *cell;
+  GtkTreeIter iter[2];
+  gchar *text;
+  gint notifies = 0;
+
+  model = GTK_TREE_MODEL (gtk_list_store_new (1, G_TYPE_STRING));
+  cell = gtk_cell_renderer_text_new ();
+  column = create_text_column (cell, model, iter);
+
+  /* Nobody is listening, so the typed setter is used */
+  gtk_tree_view_column_cell_set_cell_data (column, model, &iter[0], FALSE, FALSE);
+  g_object_get (cell, "text", &text, NULL);
+  g_assert_cmpstr (text, ==, "first");
+  g_free (text);
+
+  /* With a handler connected, the property is set and notified */
+  g_signal_connect (cell, "notify::text",
+                    G_CALLBACK (count_notify), &notifies);
+
+  gtk_tree_view_column_cell_set_cell_data (column, model, &iter[1], FALSE, FALSE);
+  g_assert_cmpint (notifies, ==, 1);
+  g_object_get (cell, "text", &text, NULL);
+  g_assert_cmpstr (text, ==, "second");
+  g_free (text);
+
+  gtk_tree_view_column_cell_set_cell_data (column, model, &iter[0], FALSE, FALSE);
+  g_assert_cmpint (notifies, ==, 2);
+  g_object_get (cell, "text", &text, NULL);
+  g_assert_cmpstr (text, ==, "first");
+  g_free (text);
+
+  g_object_unref (column);
+  g_object_unref (model);
+}
+
+static void
+test_column_set_cell_data_subclass (void)
+{
+  GtkTreeModel *model;
+  GtkTreeViewColumn *column;
+  GtkCellRenderer *cell;
+  GtkTreeIter iter[2];
+
+  model = GTK_TREE_MODEL (gtk_list_store_new (1, G_TYPE_STRING));
+  cell = g_object_new (test_text_renderer_get_type (), NULL);
+  column = create_text_column (cell, model, iter);
+
+  /* The subclass handles "text" itself, so it has to see every value */
+  gtk_tree_view_column_cell_set_cell_data (column, model, &iter[0], FALSE, FALSE);
+  g_assert_cmpstr (test_text_renderer_text, ==, "first");
+
+  gtk_tree_view_column_cell_set_cell_data (column, model, &iter[1], FALSE, FALSE);
+  g_assert_cmpstr (test_text_renderer_text, ==, "second");
+
+  g_object_unref (column);
+  g_object_unref (model);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv);
+
+  g_test_add ("/treeview/cache-rows/redraw", CacheFixture, NULL,
+              cache_fixture_setup, test_cache_rows_redraw,
+              cache_fixture_teardown);
+  g_test_add ("/treeview/cache-rows/change", CacheFixture, NULL,
+              cache_fixture_setup, test_cache_rows_change,
+              cache_fixture_teardown);
+  g_test_add ("/treeview/cache-rows/reorder", CacheFixture, NULL,
+              cache_fixture_setup, test_cache_rows_reorder,
+              cache_fixture_teardown);
+  g_test_add ("/treeview/cache-rows/collapse", CacheFixture, NULL,
+              cache_fixture_setup, test_cache_rows_collapse,
+              cache_fixture_teardown);
+  g_test_add_func ("/treeview/column/set-cell-data-notify",
+                   test_column_set_cell_data_notify);
+  g_test_add_func ("/treeview/column/set-cell-data-subclass",
+                   test_column_set_cell_data_subclass);
+
+  return g_test_run ();
+}
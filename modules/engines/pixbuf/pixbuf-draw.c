@@ -34,62 +34,93 @@ static void pixbuf_style_class_init (PixbufStyleClass *klass);
 
 static GtkStyleClass *parent_class = NULL;
 
-static ThemeImage *
-match_theme_image (GtkStyle       *style,
-		   ThemeMatchData *match_data)
+static gboolean
+theme_image_matches (ThemeImage     *image,
+		     ThemeMatchData *match_data)
 {
-  GList *tmp_list;
+  guint flags;
 
-  tmp_list = PIXBUF_RC_STYLE (style->rc_style)->img_list;
-  
-  while (tmp_list)
-    {
-      guint flags;
-      ThemeImage *image = tmp_list->data;
-      tmp_list = tmp_list->next;
+  flags = match_data->flags & image->match_data.flags;
+      
+  if (flags != image->match_data.flags) /* Required components not present */
+    return FALSE;
 
-      if (match_data->function != image->match_data.function)
-	continue;
+  if ((flags & THEME_MATCH_STATE) &&
+      match_data->state != image->match_data.state)
+    return FALSE;
 
-      flags = match_data->flags & image->match_data.flags;
+  if ((flags & THEME_MATCH_SHADOW) &&
+      match_data->shadow != image->match_data.shadow)
+    return FALSE;
       
-      if (flags != image->match_data.flags) /* Required components not present */
-	continue;
+  if ((flags & THEME_MATCH_ARROW_DIRECTION) &&
+      match_data->arrow_direction != image->match_data.arrow_direction)
+    return FALSE;
 
-      if ((flags & THEME_MATCH_STATE) &&
-	  match_data->state != image->match_data.state)
-	continue;
+  if ((flags & THEME_MATCH_ORIENTATION) &&
+      match_data->orientation != image->match_data.orientation)
+    return FALSE;
 
-      if ((flags & THEME_MATCH_SHADOW) &&
-	  match_data->shadow != image->match_data.shadow)
-	continue;
-      
-      if ((flags & THEME_MATCH_ARROW_DIRECTION) &&
-	  match_data->arrow_direction != image->match_data.arrow_direction)
-	continue;
+  if ((flags & THEME_MATCH_GAP_SIDE) &&
+      match_data->gap_side != image->match_data.gap_side)
+    return FALSE;
 
-      if ((flags & THEME_MATCH_ORIENTATION) &&
-	  match_data->orientation != image->match_data.orientation)
-	continue;
+  if ((flags & THEME_MATCH_EXPANDER_STYLE) &&
+      match_data->expander_style != image->match_data.expander_style)
+    return FALSE;
 
-      if ((flags & THEME_MATCH_GAP_SIDE) &&
-	  match_data->gap_side != image->match_data.gap_side)
-	continue;
+  if ((flags & THEME_MATCH_WINDOW_EDGE) &&
+      match_data->window_edge != image->match_data.window_edge)
+    return FALSE;
 
-      if ((flags & THEME_MATCH_EXPANDER_STYLE) &&
-	  match_data->expander_style != image->match_data.expander_style)
-	continue;
+  return TRUE;
+}
 
-      if ((flags & THEME_MATCH_WINDOW_EDGE) &&
-	  match_data->window_edge != image->match_data.window_edge)
-	continue;
+static ThemeImage *
+match_theme_image (GtkStyle       *style,
+		   ThemeMatchData *match_data)
+{
+  PixbufRcStyle *rc_style = PIXBUF_RC_STYLE (style->rc_style);
+  GArray *with_detail = NULL;
+  GArray *without_detail;
+  guint i, j;
+
+  /* Images that specify a detail only match that detail; images
+   * without one match any. Walk both candidate lists in the order
+   * the images appear in the style, so the first matching image wins
+   * as before.
+   */
+  if (match_data->detail)
+    {
+      GQuark detail = g_quark_try_string (match_data->detail);
+
+      if (detail)
+	with_detail = pixbuf_rc_style_lookup_images (rc_style,
+						     match_data->function,
+						     detail);
+    }
+  without_detail = pixbuf_rc_style_lookup_images (rc_style,
+						  match_data->function, 0);
 
-      if (image->match_data.detail &&
-	  (!match_data->detail ||
-	   strcmp (match_data->detail, image->match_data.detail) != 0))
-      continue;
+  i = 0;
+  j = 0;
+  while ((with_detail && i < with_detail->len) ||
+	 (without_detail && j < without_detail->len))
+    {
+      ThemeImageRef *ref;
+
+      if (!without_detail || j >= without_detail->len)
+	ref = &g_array_index (with_detail, ThemeImageRef, i++);
+      else if (!with_detail || i >= with_detail->len)
+	ref = &g_array_index (without_detail, ThemeImageRef, j++);
+      else if (g_array_index (with_detail, ThemeImageRef, i).position <
+	       g_array_index (without_detail, ThemeImageRef, j).position)
+	ref = &g_array_index (with_detail, ThemeImageRef, i++);
+      else
+	ref = &g_array_index (without_detail, ThemeImageRef, j++);
 
-      return image;
+      if (theme_image_matches (ref->image, match_data))
+	return ref->image;
     }
   
   return NULL;
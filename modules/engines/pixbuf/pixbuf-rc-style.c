@@ -35,6 +35,7 @@ static void      pixbuf_rc_style_merge        (GtkRcStyle         *dest,
 static GtkStyle *pixbuf_rc_style_create_style (GtkRcStyle         *rc_style);
 
 static void theme_image_unref (ThemeImage *data);
+static void theme_image_index_build (PixbufRcStyle *rc_style);
 
 static const struct
   {
@@ -186,6 +187,8 @@ pixbuf_rc_style_finalize (GObject *object)
   
   g_list_foreach (rc_style->img_list, (GFunc) theme_image_unref, NULL);
   g_list_free (rc_style->img_list);
+  if (rc_style->img_index)
+    g_hash_table_destroy (rc_style->img_index);
 
   G_OBJECT_CLASS (parent_class)->finalize (object);
 }
@@ -378,6 +381,7 @@ theme_parse_detail(GScanner * scanner,
   g_free (data->match_data.detail);
   
   data->match_data.detail = g_strdup(scanner->value.v_string);
+  data->match_data.detail_quark = g_quark_from_string (data->match_data.detail);
 
   return G_TOKEN_NONE;
 }
@@ -609,6 +613,101 @@ theme_parse_window_edge(GScanner * scanner,
   return G_TOKEN_NONE;
 }
 
+typedef struct
+{
+  guint  function;
+  GQuark detail;
+} ThemeImageKey;
+
+static guint
+theme_image_key_hash (gconstpointer v)
+{
+  const ThemeImageKey *key = v;
+
+  return (key->function << 16) ^ key->detail;
+}
+
+static gboolean
+theme_image_key_equal (gconstpointer a,
+		       gconstpointer b)
+{
+  const ThemeImageKey *ka = a;
+  const ThemeImageKey *kb = b;
+
+  return ka->function == kb->function && ka->detail == kb->detail;
+}
+
+static void
+theme_image_refs_free (GArray *refs)
+{
+  g_array_free (refs, TRUE);
+}
+
+/* Compiles img_list into img_index, so that matching an image only
+ * has to look at the images with the right function and detail
+ * instead of every image of the style.
+ */
+static void
+theme_image_index_build (PixbufRcStyle *rc_style)
+{
+  GList *tmp_list;
+  guint position;
+
+  if (rc_style->img_index)
+    g_hash_table_destroy (rc_style->img_index);
+
+  rc_style->img_index = g_hash_table_new_full (theme_image_key_hash,
+					       theme_image_key_equal,
+					       g_free,
+					       (GDestroyNotify) theme_image_refs_free);
+
+  for (tmp_list = rc_style->img_list, position = 0;
+       tmp_list;
+       tmp_list = tmp_list->next, position++)
+    {
+      ThemeImage *image = tmp_list->data;
+      ThemeImageKey lookup;
+      ThemeImageRef ref;
+      GArray *refs;
+
+      lookup.function = image->match_data.function;
+      lookup.detail = image->match_data.detail_quark;
+
+      refs = g_hash_table_lookup (rc_style->img_index, &lookup);
+      if (!refs)
+	{
+	  refs = g_array_new (FALSE, FALSE, sizeof (ThemeImageRef));
+	  g_hash_table_insert (rc_style->img_index,
+			       g_memdup (&lookup, sizeof (ThemeImageKey)),
+			       refs);
+	}
+
+      ref.position = position;
+      ref.image = image;
+      g_array_append_val (refs, ref);
+    }
+}
+
+/* Returns the images of rc_style for function and detail (0 for
+ * images without a detail) in the order they appear in the style,
+ * or NULL if there are none.
+ */
+GArray *
+pixbuf_rc_style_lookup_images (PixbufRcStyle *rc_style,
+			       guint          function,
+			       GQuark         detail)
+{
+  ThemeImageKey lookup;
+
+  if (!rc_style->img_index)
+    return NULL;
+
+  lookup.function = function;
+  lookup.detail = detail;
+
+  return g_hash_table_lookup (rc_style->img_index, &lookup);
+}
+
 static void
 theme_image_ref (ThemeImage *data)
 {
@@ -668,6 +767,7 @@ theme_parse_image(GtkSettings  *settings,
 
   data->match_data.function = 0;
   data->match_data.detail = NULL;
+  data->match_data.detail_quark = 0;
   data->match_data.flags = 0;
 
   token = g_scanner_peek_next_token(scanner);
@@ -851,6 +951,8 @@ pixbuf_rc_style_parse (GtkRcStyle *rc_style,
 
   g_scanner_set_scope(scanner, old_scope);
 
+  theme_image_index_build (pixbuf_style);
+
   return G_TOKEN_NONE;
 }
 
@@ -890,6 +992,8 @@ pixbuf_rc_style_merge (GtkRcStyle *dest,
 	      theme_image_ref (tmp_list1->data);
 	      tmp_list1 = tmp_list1->next;
 	    }
+
+	  theme_image_index_build (pixbuf_dest);
 	}
     }
 
@@ -39,6 +39,20 @@ struct _PixbufRcStyle
   GtkRcStyle parent_instance;
   
   GList *img_list;
+
+  /* Maps (function, detail quark) to the images of img_list with
+   * that function and detail, as arrays of ThemeImageRef in list
+   * order. Images without a detail are stored under quark 0.
+   */
+  GHashTable *img_index;
+};
+
+typedef struct _ThemeImageRef ThemeImageRef;
+
+struct _ThemeImageRef
+{
+  guint       position;		/* Position in img_list */
+  ThemeImage *image;
 };
 
 struct _PixbufRcStyleClass
@@ -47,3 +61,6 @@ struct _PixbufRcStyleClass
 };
 
 G_GNUC_INTERNAL  void pixbuf_rc_style_register_type (GTypeModule *module);
+G_GNUC_INTERNAL  GArray *pixbuf_rc_style_lookup_images (PixbufRcStyle *rc_style,
+                                                       guint          function,
+                                                       GQuark         detail);
@@ -303,102 +303,78 @@ replicate_cols (GdkPixbuf    *src,
   return result;
 }
 
-/* Scale the rectangle (src_x, src_y, src_width, src_height)
- * onto the rectangle (dest_x, dest_y, dest_width, dest_height)
- * of the destination, clip by clip_rect and render
+/* Scale the rectangle (src_x, src_y, src_width, src_height) of src
+ * to dest_width x dest_height and return the part of the result that
+ * lies in rect, which is relative to the origin of the destination.
+ * The position of rect within the returned pixbuf is stored in
+ * x_offset and y_offset.
  */
-static void
-pixbuf_render (GdkPixbuf    *src,
-	       guint         hints,
-	       GdkWindow    *window,
-	       GdkBitmap    *mask,
-	       GdkRectangle *clip_rect,
-	       gint          src_x,
-	       gint          src_y,
-	       gint          src_width,
-	       gint          src_height,
-	       gint          dest_x,
-	       gint          dest_y,
-	       gint          dest_width,
-	       gint          dest_height)
+static GdkPixbuf *
+scale_component (GdkPixbuf    *src,
+		 guint         hints,
+		 gint          src_x,
+		 gint          src_y,
+		 gint          src_width,
+		 gint          src_height,
+		 gint          dest_width,
+		 gint          dest_height,
+		 GdkRectangle *rect,
+		 gint         *x_offset,
+		 gint         *y_offset)
 {
   GdkPixbuf *tmp_pixbuf = NULL;
-  GdkRectangle rect;
-  int x_offset, y_offset;
   gboolean has_alpha = gdk_pixbuf_get_has_alpha (src);
   gint src_rowstride = gdk_pixbuf_get_rowstride (src);
   gint src_n_channels = gdk_pixbuf_get_n_channels (src);
 
-  if (dest_width <= 0 || dest_height <= 0)
-    return;
-
-  rect.x = dest_x;
-  rect.y = dest_y;
-  rect.width = dest_width;
-  rect.height = dest_height;
-
-  if (hints & THEME_MISSING)
-    return;
-
-  /* FIXME: Because we use the mask to shape windows, we don't use
-   * clip_rect to clip what we draw to the mask, only to clip
-   * what we actually draw. But this leads to the horrible ineffiency
-   * of scale the whole image to get a little bit of it.
-   */
-  if (!mask && clip_rect)
-    {
-      if (!gdk_rectangle_intersect (clip_rect, &rect, &rect))
-	return;
-    }
-
   if (dest_width == src_width && dest_height == src_height)
     {
       tmp_pixbuf = g_object_ref (src);
 
-      x_offset = src_x + rect.x - dest_x;
-      y_offset = src_y + rect.y - dest_y;
+      *x_offset = src_x + rect->x;
+      *y_offset = src_y + rect->y;
     }
   else if (src_width == 0 && src_height == 0)
     {
       tmp_pixbuf = bilinear_gradient (src, src_x, src_y, dest_width, dest_height);      
       
-      x_offset = rect.x - dest_x;
-      y_offset = rect.y - dest_y;
+      *x_offset = rect->x;
+      *y_offset = rect->y;
     }
   else if (src_width == 0 && dest_height == src_height)
     {
       tmp_pixbuf = horizontal_gradient (src, src_x, src_y, dest_width, dest_height);      
       
-      x_offset = rect.x - dest_x;
-      y_offset = rect.y - dest_y;
+      *x_offset = rect->x;
+      *y_offset = rect->y;
     }
   else if (src_height == 0 && dest_width == src_width)
     {
       tmp_pixbuf = vertical_gradient (src, src_x, src_y, dest_width, dest_height);
       
-      x_offset = rect.x - dest_x;
-      y_offset = rect.y - dest_y;
+      *x_offset = rect->x;
+      *y_offset = rect->y;
     }
   else if ((hints & THEME_CONSTANT_COLS) && (hints & THEME_CONSTANT_ROWS))
     {
       tmp_pixbuf = replicate_single (src, src_x, src_y, dest_width, dest_height);
 
-      x_offset = rect.x - dest_x;
-      y_offset = rect.y - dest_y;
+      *x_offset = rect->x;
+      *y_offset = rect->y;
     }
   else if (dest_width == src_width && (hints & THEME_CONSTANT_COLS))
     {
       tmp_pixbuf = replicate_rows (src, src_x, src_y, dest_width, dest_height);
 
-      x_offset = rect.x - dest_x;
-      y_offset = rect.y - dest_y;
+      *x_offset = rect->x;
+      *y_offset = rect->y;
     }
   else if (dest_height == src_height && (hints & THEME_CONSTANT_ROWS))
     {
       tmp_pixbuf = replicate_cols (src, src_x, src_y, dest_width, dest_height);
 
-      x_offset = rect.x - dest_x;
-      y_offset = rect.y - dest_y;
+      *x_offset = rect->x;
+      *y_offset = rect->y;
     }
   else if (src_width > 0 && src_height > 0)
     {
@@ -419,20 +395,328 @@ pixbuf_render (GdkPixbuf    *src,
 						  
       tmp_pixbuf = gdk_pixbuf_new (GDK_COLORSPACE_RGB,
 				   has_alpha, 8,
-				   rect.width, rect.height);
+				   rect->width, rect->height);
 
       gdk_pixbuf_scale (partial_src, tmp_pixbuf,
-			0, 0, rect.width, rect.height,
-			dest_x - rect.x, dest_y - rect.y, 
+			0, 0, rect->width, rect->height,
+			- rect->x, - rect->y, 
 			x_scale, y_scale,
 			GDK_INTERP_BILINEAR);
 
       g_object_unref (partial_src);
 
-      x_offset = 0;
-      y_offset = 0;
+      *x_offset = 0;
+      *y_offset = 0;
+    }
+
+  return tmp_pixbuf;
+}
+
+/* Scaled components are cached, keyed by the theme pixbuf, the
+ * component and the size they were scaled to. Opaque components are
+ * additionally uploaded to a server-side pixmap, so that redrawing a
+ * widget whose size did not change is a plain copy. Components of
+ * different states use different ThemePixbufs and so never share an
+ * entry.
+ */
+#define RENDER_CACHE_MAX_PIXELS       (2048 * 1024)
+#define RENDER_CACHE_MAX_ENTRY_PIXELS (RENDER_CACHE_MAX_PIXELS / 4)
+
+typedef struct _RenderCacheEntry RenderCacheEntry;
+
+struct _RenderCacheEntry
+{
+  ThemePixbuf *theme_pb;
+  guint        component;
+  gint         width;
+  gint         height;
+  GdkColormap *colormap;
+
+  GdkPixbuf   *pixbuf;
+  GdkPixmap   *pixmap;		/* NULL if the component is not opaque */
+  GdkGC       *gc;
+
+  GList       *link;
+};
+
+static GHashTable *render_cache = NULL;
+static GQueue render_cache_lru = G_QUEUE_INIT;
+static gint render_cache_pixels = 0;
+
+static guint
+render_cache_entry_hash (gconstpointer v)
+{
+  const RenderCacheEntry *entry = v;
+
+  return (GPOINTER_TO_UINT (entry->theme_pb) ^
+	  GPOINTER_TO_UINT (entry->colormap) ^
+	  (entry->component << 22) ^
+	  (entry->width << 11) ^
+	  entry->height);
+}
+
+static gboolean
+render_cache_entry_equal (gconstpointer a,
+			  gconstpointer b)
+{
+  const RenderCacheEntry *ea = a;
+  const RenderCacheEntry *eb = b;
+
+  return (ea->theme_pb == eb->theme_pb &&
+	  ea->component == eb->component &&
+	  ea->width == eb->width &&
+	  ea->height == eb->height &&
+	  ea->colormap == eb->colormap);
+}
+
+static void
+render_cache_entry_free (RenderCacheEntry *entry)
+{
+  render_cache_pixels -= entry->width * entry->height;
+
+  g_object_unref (entry->pixbuf);
+  if (entry->pixmap)
+    {
+      g_object_unref (entry->gc);
+      g_object_unref (entry->pixmap);
+    }
+  if (entry->colormap)
+    g_object_unref (entry->colormap);
+
+  g_free (entry);
+}
+
+static void
+render_cache_remove (RenderCacheEntry *entry)
+{
+  g_queue_delete_link (&render_cache_lru, entry->link);
+  g_hash_table_remove (render_cache, entry);
+  render_cache_entry_free (entry);
+}
+
+/* Drops all cached renderings of theme_pb, for when its image,
+ * borders or hints change, or it is destroyed.
+ */
+static void
+theme_pixbuf_uncache (ThemePixbuf *theme_pb)
+{
+  GList *l, *next;
+
+  for (l = render_cache_lru.head; l; l = next)
+    {
+      RenderCacheEntry *entry = l->data;
+
+      next = l->next;
+
+      if (entry->theme_pb == theme_pb)
+	render_cache_remove (entry);
+    }
+}
+
+static gboolean
+pixbuf_is_opaque (GdkPixbuf *pixbuf)
+{
+  gint width = gdk_pixbuf_get_width (pixbuf);
+  gint height = gdk_pixbuf_get_height (pixbuf);
+  gint rowstride = gdk_pixbuf_get_rowstride (pixbuf);
+  guchar *pixels = gdk_pixbuf_get_pixels (pixbuf);
+  int i, j;
+
+  if (!gdk_pixbuf_get_has_alpha (pixbuf))
+    return TRUE;
+
+  for (i = 0; i < height; i++)
+    {
+      guchar *p = pixels + i * rowstride + 3;
+
+      for (j = 0; j < width; j++, p += 4)
+	if (*p != 0xff)
+	  return FALSE;
+    }
+
+  return TRUE;
+}
+
+static RenderCacheEntry *
+render_cache_lookup (ThemePixbuf *theme_pb,
+		     guint        component,
+		     GdkPixbuf   *src,
+		     guint        hints,
+		     GdkWindow   *window,
+		     gint         src_x,
+		     gint         src_y,
+		     gint         src_width,
+		     gint         src_height,
+		     gint         dest_width,
+		     gint         dest_height)
+{
+  RenderCacheEntry key = { NULL, };
+  RenderCacheEntry *entry;
+  GdkRectangle rect;
+  GdkPixbuf *pixbuf;
+  gint x_offset, y_offset;
+
+  if (!render_cache)
+    render_cache = g_hash_table_new (render_cache_entry_hash,
+				     render_cache_entry_equal);
+
+  key.theme_pb = theme_pb;
+  key.component = component;
+  key.width = dest_width;
+  key.height = dest_height;
+  key.colormap = gdk_drawable_get_colormap (window);
+
+  entry = g_hash_table_lookup (render_cache, &key);
+  if (entry)
+    {
+      g_queue_unlink (&render_cache_lru, entry->link);
+      g_queue_push_head_link (&render_cache_lru, entry->link);
+
+      return entry;
+    }
+
+  rect.x = 0;
+  rect.y = 0;
+  rect.width = dest_width;
+  rect.height = dest_height;
+
+  pixbuf = scale_component (src, hints,
+			    src_x, src_y, src_width, src_height,
+			    dest_width, dest_height,
+			    &rect, &x_offset, &y_offset);
+  if (!pixbuf)
+    return NULL;
+
+  entry = g_new (RenderCacheEntry, 1);
+  *entry = key;
+  if (entry->colormap)
+    g_object_ref (entry->colormap);
+
+  if (x_offset != 0 || y_offset != 0 ||
+      gdk_pixbuf_get_width (pixbuf) != dest_width ||
+      gdk_pixbuf_get_height (pixbuf) != dest_height)
+    {
+      entry->pixbuf = gdk_pixbuf_new_subpixbuf (pixbuf, x_offset, y_offset,
+						dest_width, dest_height);
+      g_object_unref (pixbuf);
+    }
+  else
+    entry->pixbuf = pixbuf;
+
+  if (entry->colormap && pixbuf_is_opaque (entry->pixbuf))
+    {
+      entry->pixmap = gdk_pixmap_new (window, dest_width, dest_height, -1);
+      entry->gc = gdk_gc_new (entry->pixmap);
+      gdk_draw_pixbuf (entry->pixmap, entry->gc, entry->pixbuf,
+		       0, 0, 0, 0, dest_width, dest_height,
+		       GDK_RGB_DITHER_NORMAL, 0, 0);
+    }
+
+  render_cache_pixels += dest_width * dest_height;
+  while (render_cache_pixels > RENDER_CACHE_MAX_PIXELS &&
+	 render_cache_lru.tail)
+    render_cache_remove (render_cache_lru.tail->data);
+
+  g_queue_push_head (&render_cache_lru, entry);
+  entry->link = render_cache_lru.head;
+  g_hash_table_insert (render_cache, entry, entry);
+
+  return entry;
+}
+
+/* Scale the rectangle (src_x, src_y, src_width, src_height)
+ * onto the rectangle (dest_x, dest_y, dest_width, dest_height)
+ * of the destination, clip by clip_rect and render
+ */
+static void
+pixbuf_render (ThemePixbuf  *theme_pb,
+	       guint         component,
+	       GdkPixbuf    *src,
+	       guint         hints,
+	       GdkWindow    *window,
+	       GdkBitmap    *mask,
+	       GdkRectangle *clip_rect,
+	       gint          src_x,
+	       gint          src_y,
+	       gint          src_width,
+	       gint          src_height,
+	       gint          dest_x,
+	       gint          dest_y,
+	       gint          dest_width,
+	       gint          dest_height)
+{
+  GdkPixbuf *tmp_pixbuf = NULL;
+  GdkRectangle rect;
+  int x_offset, y_offset;
+
+  if (dest_width <= 0 || dest_height <= 0)
+    return;
+
+  rect.x = dest_x;
+  rect.y = dest_y;
+  rect.width = dest_width;
+  rect.height = dest_height;
+
+  if (hints & THEME_MISSING)
+    return;
+
+  /* FIXME: Because we use the mask to shape windows, we don't use
+   * clip_rect to clip what we draw to the mask, only to clip
+   * what we actually draw. But this leads to the horrible ineffiency
+   * of scale the whole image to get a little bit of it.
+   */
+  if (!mask && clip_rect)
+    {
+      if (!gdk_rectangle_intersect (clip_rect, &rect, &rect))
+	return;
+    }
+
+  if (theme_pb && dest_width * dest_height <= RENDER_CACHE_MAX_ENTRY_PIXELS)
+    {
+      RenderCacheEntry *entry;
+
+      entry = render_cache_lookup (theme_pb, component, src, hints, window,
+				   src_x, src_y, src_width, src_height,
+				   dest_width, dest_height);
+      if (!entry)
+	return;
+
+      x_offset = rect.x - dest_x;
+      y_offset = rect.y - dest_y;
+
+      if (mask)
+	{
+	  gdk_pixbuf_render_threshold_alpha (entry->pixbuf, mask,
+					     x_offset, y_offset,
+					     rect.x, rect.y,
+					     rect.width, rect.height,
+					     128);
+	}
+
+      if (entry->pixmap)
+	gdk_draw_drawable (window, entry->gc, entry->pixmap,
+			   x_offset, y_offset,
+			   rect.x, rect.y,
+			   rect.width, rect.height);
+      else
+	gdk_draw_pixbuf (window, NULL, entry->pixbuf,
+			 x_offset, y_offset,
+			 rect.x, rect.y,
+			 rect.width, rect.height,
+			 GDK_RGB_DITHER_NORMAL,
+			 0, 0);
+      return;
     }
 
+  rect.x -= dest_x;
+  rect.y -= dest_y;
+  tmp_pixbuf = scale_component (src, hints,
+				src_x, src_y, src_width, src_height,
+				dest_width, dest_height,
+				&rect, &x_offset, &y_offset);
+  rect.x += dest_x;
+  rect.y += dest_y;
+
   if (tmp_pixbuf)
     {
       if (mask)
@@ -481,6 +765,8 @@ void
 theme_pixbuf_set_filename (ThemePixbuf *theme_pb,
 			   const char  *filename)
 {
+  theme_pixbuf_uncache (theme_pb);
+
   if (theme_pb->pixbuf)
     {
       g_cache_remove (pixbuf_cache, theme_pb->pixbuf);
@@ -567,6 +853,8 @@ theme_pixbuf_compute_hints (ThemePixbuf *theme_pb)
   gint width = gdk_pixbuf_get_width (theme_pb->pixbuf);
   gint height = gdk_pixbuf_get_height (theme_pb->pixbuf);
 
+  theme_pixbuf_uncache (theme_pb);
+
   if (theme_pb->border_left + theme_pb->border_right > width ||
       theme_pb->border_top + theme_pb->border_bottom > height)
     {
@@ -653,6 +941,8 @@ theme_pixbuf_set_stretch (ThemePixbuf *theme_pb,
 {
   theme_pb->stretch = stretch;
 
+  theme_pixbuf_uncache (theme_pb);
+
   if (theme_pb->pixbuf)
     theme_pixbuf_compute_hints (theme_pb);
 }
@@ -753,39 +1043,40 @@ theme_pixbuf_render (ThemePixbuf  *theme_pb,
 
 
 
-#define RENDER_COMPONENT(X1,X2,Y1,Y2)					         \
-        pixbuf_render (pixbuf, theme_pb->hints[Y1][X1], window, mask, clip_rect, \
+#define RENDER_COMPONENT(C,X1,X2,Y1,Y2)				         \
+        pixbuf_render (theme_pb, C,					         \
+		       pixbuf, theme_pb->hints[Y1][X1], window, mask, clip_rect, \
 	 	       src_x[X1], src_y[Y1],				         \
 		       src_x[X2] - src_x[X1], src_y[Y2] - src_y[Y1],	         \
 		       dest_x[X1], dest_y[Y1],				         \
 		       dest_x[X2] - dest_x[X1], dest_y[Y2] - dest_y[Y1]);
       
       if (component_mask & COMPONENT_NORTH_WEST)
-	RENDER_COMPONENT (0, 1, 0, 1);
+	RENDER_COMPONENT (COMPONENT_NORTH_WEST, 0, 1, 0, 1);
 
       if (component_mask & COMPONENT_NORTH)
-	RENDER_COMPONENT (1, 2, 0, 1);
+	RENDER_COMPONENT (COMPONENT_NORTH, 1, 2, 0, 1);
 
       if (component_mask & COMPONENT_NORTH_EAST)
-	RENDER_COMPONENT (2, 3, 0, 1);
+	RENDER_COMPONENT (COMPONENT_NORTH_EAST, 2, 3, 0, 1);
 
       if (component_mask & COMPONENT_WEST)
-	RENDER_COMPONENT (0, 1, 1, 2);
+	RENDER_COMPONENT (COMPONENT_WEST, 0, 1, 1, 2);
 
       if (component_mask & COMPONENT_CENTER)
-	RENDER_COMPONENT (1, 2, 1, 2);
+	RENDER_COMPONENT (COMPONENT_CENTER, 1, 2, 1, 2);
 
       if (component_mask & COMPONENT_EAST)
-	RENDER_COMPONENT (2, 3, 1, 2);
+	RENDER_COMPONENT (COMPONENT_EAST, 2, 3, 1, 2);
 
       if (component_mask & COMPONENT_SOUTH_WEST)
-	RENDER_COMPONENT (0, 1, 2, 3);
+	RENDER_COMPONENT (COMPONENT_SOUTH_WEST, 0, 1, 2, 3);
 
       if (component_mask & COMPONENT_SOUTH)
-	RENDER_COMPONENT (1, 2, 2, 3);
+	RENDER_COMPONENT (COMPONENT_SOUTH, 1, 2, 2, 3);
 
       if (component_mask & COMPONENT_SOUTH_EAST)
-	RENDER_COMPONENT (2, 3, 2, 3);
+	RENDER_COMPONENT (COMPONENT_SOUTH_EAST, 2, 3, 2, 3);
     }
   else
     {
@@ -794,7 +1085,8 @@ theme_pixbuf_render (ThemePixbuf  *theme_pb,
 	  x += (width - pixbuf_width) / 2;
 	  y += (height - pixbuf_height) / 2;
 	  
-	  pixbuf_render (pixbuf, 0, window, NULL, clip_rect,
+	  pixbuf_render (theme_pb, COMPONENT_ALL,
+			 pixbuf, 0, window, NULL, clip_rect,
 			 0, 0,
 			 pixbuf_width, pixbuf_height,
 			 x, y,
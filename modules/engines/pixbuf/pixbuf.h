@@ -160,6 +160,7 @@ struct _ThemeMatchData
 {
   guint            function;	/* Mandatory */
   gchar           *detail;
+  GQuark           detail_quark;	/* Interned detail, for images */
 
   ThemeMatchFlags  flags;
 
@@ -1,9 +1,12 @@
 #include <stdio.h>
+#include <string.h>
 #include <gtk/gtk.h>
 #include "gtkwidgetprofiler.h"
 #include "widgets.h"
 
 #define ITERS 100000
+#define TEXT_VIEW_ITERS 1000
+#define SPARSE_EXPOSE_ITERS 1000
 
 static GtkWidget *
 create_widget_cb (GtkWidgetProfiler *profiler, gpointer data)
@@ -51,6 +54,18 @@ main (int argc, char **argv)
 
   gtk_init (&argc, &argv);
 
+  if (argc > 1 && strcmp (argv[1], "--text-view") == 0)
+    {
+      text_view_profile_editing (TEXT_VIEW_ITERS);
+      return 0;
+    }
+
+  if (argc > 1 && strcmp (argv[1], "--sparse-expose") == 0)
+    {
+      sparse_expose_profile (SPARSE_EXPOSE_ITERS);
+      return 0;
+    }
+
   profiler = gtk_widget_profiler_new ();
   g_signal_connect (profiler, "create-widget",
 		    G_CALLBACK (create_widget_cb), NULL);
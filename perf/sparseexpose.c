@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <gtk/gtk.h>
+#include "widgets.h"
+
+#define AREA_WIDTH  800
+#define AREA_HEIGHT 600
+#define DAMAGE_SIZE 32
+
+typedef struct
+{
+  guint64 pixels;
+  guint n_exposes;
+} PaintStats;
+
+static gboolean
+expose_cb (GtkWidget      *widget,
+	   GdkEventExpose *event,
+	   PaintStats     *stats)
+{
+  /* Like many widgets, repaint the whole expose area rather than
+   * only the region.
+   */
+  gdk_draw_rectangle (widget->window,
+		      widget->style->base_gc[GTK_STATE_NORMAL],
+		      TRUE,
+		      event->area.x, event->area.y,
+		      event->area.width, event->area.height);
+
+  stats->pixels += event->area.width * event->area.height;
+  stats->n_exposes++;
+
+  return TRUE;
+}
+
+static void
+wait_for_redraw (GtkWidget *widget)
+{
+  while (gtk_events_pending ())
+    gtk_main_iteration ();
+
+  gdk_window_process_all_updates ();
+  gdk_display_sync (gtk_widget_get_display (widget));
+}
+
+static void
+profile_sparse_expose (gboolean split,
+		       gint     iterations)
+{
+  GtkWidget *window;
+  GtkWidget *area;
+  GdkRectangle rect;
+  PaintStats stats = { 0, };
+  GTimer *timer;
+  gdouble elapsed;
+  gint bytes_per_pixel;
+  gint depth;
+  gint i;
+
+  if (split)
+    gdk_window_set_update_split_policy (0.5, 128 * 128, 4);
+  else
+    gdk_window_set_update_split_policy (0.5, 128 * 128, 0);
+
+  window = gtk_window_new (GTK_WINDOW_TOPLEVEL);
+  area = gtk_drawing_area_new ();
+  gtk_widget_set_size_request (area, AREA_WIDTH, AREA_HEIGHT);
+  gtk_container_add (GTK_CONTAINER (window), area);
+
+  g_signal_connect (area, "expose-event", G_CALLBACK (expose_cb), &stats);
+
+  gtk_widget_show_all (window);
+  wait_for_redraw (window);
+
+  stats.pixels = 0;
+  stats.n_exposes = 0;
+
+  timer = g_timer_new ();
+
+  for (i = 0; i < iterations; i++)
+    {
+      /* Damage two opposite corners */
+      rect.x = 0;
+      rect.y = 0;
+      rect.width = DAMAGE_SIZE;
+      rect.height = DAMAGE_SIZE;
+      gdk_window_invalidate_rect (area->window, &rect, FALSE);
+
+      rect.x = area->allocation.width - DAMAGE_SIZE;
+      rect.y = area->allocation.height - DAMAGE_SIZE;
+      gdk_window_invalidate_rect (area->window, &rect, FALSE);
+
+      wait_for_redraw (window);
+    }
+
+  elapsed = g_timer_elapsed (timer, NULL);
+  g_timer_destroy (timer);
+
+  depth = gdk_drawable_get_depth (area->window);
+  bytes_per_pixel = depth > 16 ? 4 : depth > 8 ? 2 : 1;
+
+  fprintf (stdout,
+	   "sparse expose%s: %g sec, %u exposes, "
+	   "%" G_GUINT64_FORMAT " pixels, %" G_GUINT64_FORMAT " bytes painted\n",
+	   split ? " (split updates)" : "",
+	   elapsed, stats.n_exposes,
+	   stats.pixels, stats.pixels * bytes_per_pixel);
+
+  gtk_widget_destroy (window);
+}
+
+/* Repeatedly damages two small opposite corners of a large drawing
+ * area and reports the time taken and the amount of backing store
+ * painted, with and without splitting sparse update regions into
+ * several expose events.
+ */
+void
+sparse_expose_profile (gint iterations)
+{
+  gdouble min_coverage;
+  gint min_area, max_passes;
+
+  gdk_window_get_update_split_policy (&min_coverage, &min_area, &max_passes);
+
+  profile_sparse_expose (FALSE, iterations);
+  profile_sparse_expose (TRUE, iterations);
+
+  gdk_window_set_update_split_policy (min_coverage, min_area, max_passes);
+}
@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include <gtk/gtk.h>
 #include "widgets.h"
 
@@ -58,3 +59,84 @@ text_view_new (void)
 
   return sw;
 }
+
+static void
+wait_for_redraw (GtkWidget *widget)
+{
+  while (gtk_events_pending ())
+    gtk_main_iteration ();
+
+  gdk_window_process_all_updates ();
+  gdk_display_sync (gtk_widget_get_display (widget));
+}
+
+static void
+profile_editing (gboolean cache_rendering,
+                 gint     iterations)
+{
+  GtkWidget *window;
+  GtkWidget *sw;
+  GtkWidget *text_view;
+  GtkTextBuffer *buffer;
+  GtkTextIter iter;
+  GTimer *timer;
+  gint i;
+
+  window = gtk_window_new (GTK_WINDOW_TOPLEVEL);
+  sw = text_view_new ();
+  gtk_container_add (GTK_CONTAINER (window), sw);
+  text_view = gtk_bin_get_child (GTK_BIN (sw));
+
+  gtk_text_view_set_cache_rendering (GTK_TEXT_VIEW (text_view),
+                                     cache_rendering);
+
+  gtk_widget_show_all (window);
+  gtk_widget_grab_focus (text_view);
+  wait_for_redraw (window);
+
+  buffer = gtk_text_view_get_buffer (GTK_TEXT_VIEW (text_view));
+  gtk_text_buffer_get_iter_at_line (buffer, &iter, 10);
+  gtk_text_buffer_place_cursor (buffer, &iter);
+  wait_for_redraw (window);
+
+  timer = g_timer_new ();
+
+  for (i = 0; i < iterations; i++)
+    {
+      gtk_text_view_set_cursor_visible (GTK_TEXT_VIEW (text_view), i % 2);
+      gtk_widget_queue_draw (text_view);
+      wait_for_redraw (window);
+    }
+
+  fprintf (stdout, "text view cursor blink%s: %g sec\n",
+           cache_rendering ? " (cached rendering)" : "",
+           g_timer_elapsed (timer, NULL));
+
+  gtk_text_view_set_cursor_visible (GTK_TEXT_VIEW (text_view), TRUE);
+  g_timer_start (timer);
+
+  for (i = 0; i < iterations; i++)
+    {
+      gtk_text_buffer_insert_at_cursor (buffer, "a", 1);
+      wait_for_redraw (window);
+    }
+
+  fprintf (stdout, "text view typing%s: %g sec\n",
+           cache_rendering ? " (cached rendering)" : "",
+           g_timer_elapsed (timer, NULL));
+
+  g_timer_destroy (timer);
+  gtk_widget_destroy (window);
+}
+
+/* Times redrawing a text view for cursor blinks and for typing
+ * single characters, with and without cached paragraph rendering.
+ * Every iteration redraws the whole view, like an expose after
+ * another window moved over it would.
+ */
+void
+text_view_profile_editing (gint iterations)
+{
+  profile_editing (FALSE, iterations);
+  profile_editing (TRUE, iterations);
+}
@@ -3,5 +3,8 @@
 GtkWidget *appwindow_new (void);
 
 GtkWidget *text_view_new (void);
+void       text_view_profile_editing (gint iterations);
 
 GtkWidget *tree_view_new (void);
+
+void       sparse_expose_profile (gint iterations);